@@ -0,0 +1,429 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_bench.c
+*@brief     NVM benchmark on simulated memory driver
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+*   Drives public NVM API against simulated memory and prints one CSV
+*   line per measured operation.
+*
+*   Sweeps driver (EEPROM emulated flash or directly accessed EEPROM),
+*   region size and access size. Region count is fixed per build by
+*   NVM_BENCH_REGION_NUM. Operations are spread round-robin over all
+*   regions.
+*
+*   Reported per operation:
+*       - ns_per_op:            host time spent in NVM API
+*       - dev_ns_per_op:        simulated memory time (configured latencies)
+*       - drv_calls_per_op:     low level read, write and erase calls
+*       - prog_bytes_per_op:    bytes programmed to memory
+*       - erased_pages_per_op:  pages erased
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "nvm_cfg.h"
+#include "nvm/src/nvm.h"
+#include "nvm/sim/nvm_sim.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Number of measured read and write operations
+ */
+#ifndef NVM_BENCH_OPS
+    #define NVM_BENCH_OPS           ( 20000U )
+#endif
+
+/**
+ *  Number of measured write and sync operations
+ */
+#ifndef NVM_BENCH_SYNC_OPS
+    #define NVM_BENCH_SYNC_OPS      ( 200U )
+#endif
+
+/**
+ *  Number of measured initializations
+ */
+#ifndef NVM_BENCH_INIT_OPS
+    #define NVM_BENCH_INIT_OPS      ( 20U )
+#endif
+
+/**
+ *  Largest access size
+ */
+#define NVM_BENCH_ACCESS_MAX        ( 256U )
+
+/**
+ *  Measured operation
+ */
+typedef enum
+{
+    eNVM_BENCH_OP_INIT = 0,     /**<nvm_init() */
+    eNVM_BENCH_OP_READ,         /**<nvm_read() */
+    eNVM_BENCH_OP_WRITE,        /**<nvm_write() */
+    eNVM_BENCH_OP_WRITE_SYNC,   /**<nvm_write() followed by nvm_sync() */
+
+    eNVM_BENCH_OP_NUM_OF
+} nvm_bench_op_t;
+
+/**
+ *  Measurement in progress
+ */
+typedef struct
+{
+    uint64_t            start_ns;       /**<Host time at start */
+    uint64_t            host_ns;        /**<Accumulated host time */
+    nvm_mem_drv_name_t  drv;            /**<Driver of all regions */
+    uint32_t            region_size;    /**<Size of each region */
+    uint32_t            access_size;    /**<Size of single access, 0 if not applicable */
+} nvm_bench_meas_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Swept region and access sizes
+ */
+static const uint32_t g_region_size[] = { 0x100U, 0x400U, 0x1000U, 0x4000U };
+static const uint32_t g_access_size[] = { 4U, 32U, NVM_BENCH_ACCESS_MAX };
+
+/**
+ *  Simulated memories
+ *
+ *  @note   Latencies are typical order of magnitude of internal NOR
+ *          flash and of external SPI EEPROM.
+ */
+static const nvm_sim_cfg_t g_sim_cfg[ eNVM_MEM_DRV_NUM_OF ] =
+{
+    [eNVM_MEM_DRV_BENCH_EE]     = { .flash_en = true,  .read_ns = 100U,  .read_byte_ns = 1U,   .prog_ns = 0U,        .prog_byte_ns = 5000U, .erase_ns = 20000000U },
+    [eNVM_MEM_DRV_BENCH_DIRECT] = { .flash_en = false, .read_ns = 2000U, .read_byte_ns = 800U, .prog_ns = 5000000U,  .prog_byte_ns = 800U,  .erase_ns = 5000000U  },
+};
+
+/**
+ *  Names used in report
+ */
+static const char * const g_drv_name[ eNVM_MEM_DRV_NUM_OF ] =
+{
+    [eNVM_MEM_DRV_BENCH_EE]     = "ee",
+    [eNVM_MEM_DRV_BENCH_DIRECT] = "direct",
+};
+
+static const char * const g_op_name[ eNVM_BENCH_OP_NUM_OF ] =
+{
+    [eNVM_BENCH_OP_INIT]        = "init",
+    [eNVM_BENCH_OP_READ]        = "read",
+    [eNVM_BENCH_OP_WRITE]       = "write",
+    [eNVM_BENCH_OP_WRITE_SYNC]  = "write_sync",
+};
+
+/**
+ *  Data buffers, written data alternates so that each write changes memory
+ */
+static uint8_t g_data[2][NVM_BENCH_ACCESS_MAX] = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get host monotonic time
+*
+* @return 		time    - Time in nanoseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t nvm_bench_get_ns(void)
+{
+    struct timespec ts = { 0 };
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ((uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Abort benchmark on failed NVM operation
+*
+* @param[in]	status	- Status of operation
+* @param[in]	p_what	- Operation name
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_check(const nvm_status_t status, const char * const p_what)
+{
+    if ( eNVM_OK != status )
+    {
+        fprintf( stderr, "nvm_bench: %s failed with status %d\n", p_what, (int) status );
+        exit( EXIT_FAILURE );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start measurement
+*
+* @param[out]	p_meas  - Measurement
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_start(nvm_bench_meas_t * const p_meas)
+{
+    nvm_sim_reset_stats();
+    nvm_cfg_reset_drv_calls();
+
+    p_meas->host_ns = 0U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Resume host timer of measurement
+*
+* @param[in]	p_meas  - Measurement
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_resume(nvm_bench_meas_t * const p_meas)
+{
+    p_meas->start_ns = nvm_bench_get_ns();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Pause host timer of measurement
+*
+* @param[in]	p_meas  - Measurement
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_pause(nvm_bench_meas_t * const p_meas)
+{
+    p_meas->host_ns += ( nvm_bench_get_ns() - p_meas->start_ns );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Print measurement as CSV line
+*
+* @param[in]	p_meas  - Measurement
+* @param[in]	op      - Measured operation
+* @param[in]	ops     - Number of operations
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_report(const nvm_bench_meas_t * const p_meas, const nvm_bench_op_t op, const uint32_t ops)
+{
+    nvm_sim_stats_t stats = { 0 };
+
+    nvm_sim_get_stats( &stats );
+
+    printf( "%d.%d.%d,%d,%s,%u,%u,%s,%u,%.1f,%.1f,%.3f,%.3f,%.3f\n",
+            NVM_VER_MAJOR, NVM_VER_MINOR, NVM_VER_DEVELOP,
+            (int) eNVM_REGION_NUM_OF,
+            g_drv_name[ p_meas->drv ],
+            (unsigned) p_meas->region_size,
+            (unsigned) p_meas->access_size,
+            g_op_name[op],
+            (unsigned) ops,
+            (double) p_meas->host_ns / ops,
+            (double) stats.time_ns / ops,
+            (double) nvm_cfg_get_drv_calls() / ops,
+            (double) stats.prog_bytes / ops,
+            (double) stats.erase_num / ops );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store all regions and de-initialize NVM
+*
+* @note     Next nvm_init() loads regions from memory again, so that
+*           layout can be changed in between.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_reset(void)
+{
+    for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+    {
+        nvm_bench_check( nvm_sync((nvm_region_name_t) region ), "nvm_sync" );
+    }
+
+    nvm_bench_check( nvm_deinit(), "nvm_deinit" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Measure initialization
+*
+* @note     Initialization of EEPROM emulation loads all regions.
+*
+* @param[in]	p_meas  - Measurement
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_init(nvm_bench_meas_t * const p_meas)
+{
+    nvm_bench_start( p_meas );
+
+    for ( uint32_t i = 0U; i < NVM_BENCH_INIT_OPS; i++ )
+    {
+        nvm_bench_resume( p_meas );
+        nvm_bench_check( nvm_init(), "nvm_init" );
+        nvm_bench_pause( p_meas );
+
+        nvm_bench_reset();
+    }
+
+    nvm_bench_report( p_meas, eNVM_BENCH_OP_INIT, NVM_BENCH_INIT_OPS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Measure access
+*
+* @note     Operation i accesses region i modulo number of regions, each
+*           region is walked sequentially in steps of access size.
+*
+* @param[in]	p_meas  - Measurement
+* @param[in]	op      - Measured operation
+* @param[in]	ops     - Number of operations
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_bench_access(nvm_bench_meas_t * const p_meas, const nvm_bench_op_t op, const uint32_t ops)
+{
+    const uint32_t      size    = p_meas->access_size;
+    const uint32_t      slots   = ( p_meas->region_size / size );
+    uint8_t             buf[NVM_BENCH_ACCESS_MAX];
+    nvm_region_name_t   region  = (nvm_region_name_t) 0;
+    uint32_t            addr    = 0U;
+
+    nvm_bench_start( p_meas );
+    nvm_bench_resume( p_meas );
+
+    for ( uint32_t i = 0U; i < ops; i++ )
+    {
+        region  = (nvm_region_name_t)( i % eNVM_REGION_NUM_OF );
+        addr    = ((( i / eNVM_REGION_NUM_OF ) % slots ) * size );
+
+        switch( op )
+        {
+            case eNVM_BENCH_OP_READ:
+                nvm_bench_check( nvm_read( region, addr, size, buf ), "nvm_read" );
+                break;
+
+            case eNVM_BENCH_OP_WRITE:
+                nvm_bench_check( nvm_write( region, addr, size, g_data[ i & 1U ] ), "nvm_write" );
+                break;
+
+            case eNVM_BENCH_OP_WRITE_SYNC:
+                nvm_bench_check( nvm_write( region, addr, size, g_data[ i & 1U ] ), "nvm_write" );
+                nvm_bench_check( nvm_sync( region ), "nvm_sync" );
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    nvm_bench_pause( p_meas );
+    nvm_bench_report( p_meas, op, ops );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run benchmark
+*
+* @note     Prints CSV header unless started with "--no-header", so that
+*           outputs of builds with different region count can be joined.
+*
+* @param[in]	argc    - Number of arguments
+* @param[in]	argv    - Arguments
+* @return 		exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    nvm_bench_meas_t meas = { 0 };
+
+    if  (   ( argc < 2 )
+        ||  ( 0 != strcmp( argv[1], "--no-header" )))
+    {
+        printf( "version,regions,driver,region_size,access_size,op,ops,ns_per_op,dev_ns_per_op,drv_calls_per_op,prog_bytes_per_op,erased_pages_per_op\n" );
+    }
+
+    memset( g_data[0], 0x55U, sizeof( g_data[0] ));
+    memset( g_data[1], 0xAAU, sizeof( g_data[1] ));
+
+    // Driver without flash geometry is exercised by checks only
+    for ( uint32_t drv = 0U; drv <= eNVM_MEM_DRV_BENCH_DIRECT; drv++ )
+    {
+        for ( uint32_t rs = 0U; rs < ( sizeof( g_region_size ) / sizeof( g_region_size[0] )); rs++ )
+        {
+            // Layout must fit simulated memory
+            if ( false == nvm_cfg_set_layout((nvm_mem_drv_name_t) drv, g_region_size[rs] ))
+            {
+                continue;
+            }
+
+            meas.drv            = (nvm_mem_drv_name_t) drv;
+            meas.region_size    = g_region_size[rs];
+            meas.access_size    = 0U;
+
+            // Start from blank memory
+            nvm_sim_set_cfg( &g_sim_cfg[drv] );
+            nvm_bench_check( nvm_sim_erase( 0U, NVM_SIM_SIZE ), "nvm_sim_erase" );
+
+            nvm_bench_init( &meas );
+
+            nvm_bench_check( nvm_init(), "nvm_init" );
+
+            for ( uint32_t as = 0U; as < ( sizeof( g_access_size ) / sizeof( g_access_size[0] )); as++ )
+            {
+                if ( g_access_size[as] <= g_region_size[rs] )
+                {
+                    meas.access_size = g_access_size[as];
+
+                    nvm_bench_access( &meas, eNVM_BENCH_OP_READ, NVM_BENCH_OPS );
+                    nvm_bench_access( &meas, eNVM_BENCH_OP_WRITE, NVM_BENCH_OPS );
+                    nvm_bench_access( &meas, eNVM_BENCH_OP_WRITE_SYNC, NVM_BENCH_SYNC_OPS );
+                }
+            }
+
+            nvm_bench_reset();
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
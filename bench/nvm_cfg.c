@@ -0,0 +1,286 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_cfg.c
+*@brief     Non-Volatile memory configuration of benchmark
+*@author    Ziga Miklosic
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Non-volatile memory configuration of benchmark.
+*
+* 	Both memory drivers are backed by simulated memory. Region table is
+* 	built at run-time by nvm_cfg_set_layout(), so that benchmark can
+* 	sweep region size and driver without rebuild. Calls of low level
+* 	read, write and erase functions are counted.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "nvm_cfg.h"
+#include "nvm/src/nvm.h"
+
+// USER CODE BEGIN...
+
+#include "nvm/sim/nvm_sim.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// USER CODE BEGIN...
+
+/**
+ * 	Flash page and programming unit of EEPROM emulated driver
+ */
+#define NVM_BENCH_PAGE_SIZE						( NVM_SIM_PAGE_SIZE )
+#define NVM_BENCH_PROG_SIZE						( 8U )
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_cfg_drv_write	(const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+static nvm_status_t nvm_cfg_drv_read	(const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+static nvm_status_t nvm_cfg_drv_erase	(const uint32_t addr, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	NVM low-level memory driver
+ *
+ * 	@note	All drivers access the same simulated memory, benchmark
+ * 			places regions to one of them at a time.
+ */
+static const nvm_mem_driver_t g_mem_driver[ eNVM_MEM_DRV_NUM_OF ]=
+{
+	// USER CODE BEGIN...
+
+	[eNVM_MEM_DRV_BENCH_EE] =
+	{
+		.pf_nvm_init   = nvm_sim_init,
+		.pf_nvm_deinit = nvm_sim_deinit,
+		.pf_nvm_write  = nvm_cfg_drv_write,
+		.pf_nvm_read   = nvm_cfg_drv_read,
+		.pf_nvm_erase  = nvm_cfg_drv_erase,
+
+		.ee_en      = true,
+		.page_size  = NVM_BENCH_PAGE_SIZE,
+		.prog_size  = NVM_BENCH_PROG_SIZE,
+		.mem_size   = NVM_SIM_SIZE,
+	},
+
+	[eNVM_MEM_DRV_BENCH_DIRECT] =
+	{
+		.pf_nvm_init   = nvm_sim_init,
+		.pf_nvm_deinit = nvm_sim_deinit,
+		.pf_nvm_write  = nvm_cfg_drv_write,
+		.pf_nvm_read   = nvm_cfg_drv_read,
+		.pf_nvm_erase  = nvm_cfg_drv_erase,
+
+		.ee_en      = false,
+		.mem_size   = NVM_SIM_SIZE,
+	},
+
+	[eNVM_MEM_DRV_CHECK_EE_RAW] =
+	{
+		.pf_nvm_init   = nvm_sim_init,
+		.pf_nvm_deinit = nvm_sim_deinit,
+		.pf_nvm_write  = nvm_cfg_drv_write,
+		.pf_nvm_read   = nvm_cfg_drv_read,
+		.pf_nvm_erase  = nvm_cfg_drv_erase,
+
+		.ee_en      = true,
+		.mem_size   = NVM_SIM_SIZE,
+	},
+
+	// USER CODE END...
+};
+
+/**
+ * 		NVM region definitions
+ *
+ *	@note	Allocated and filled by nvm_cfg_set_layout().
+ */
+static nvm_region_t * gp_nvm_region = NULL;
+
+/**
+ * 	Number of low level read, write and erase calls
+ */
+static uint32_t g_drv_calls = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted write of simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Data to write
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_cfg_drv_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	g_drv_calls++;
+
+	return nvm_sim_write( addr, size, p_data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted read of simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_cfg_drv_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	g_drv_calls++;
+
+	return nvm_sim_read( addr, size, p_data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted erase of simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_cfg_drv_erase(const uint32_t addr, const uint32_t size)
+{
+	g_drv_calls++;
+
+	return nvm_sim_erase( addr, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get configuration of NVM memory drivers
+*
+* @return	Pointer to NVM memory drivers configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const void * nvm_cfg_get_drivers(void)
+{
+    return (const nvm_mem_driver_t*) &g_mem_driver;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get configuration of NVM regions
+*
+* @return	Pointer to NVM memory regions configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const void * nvm_cfg_get_regions(void)
+{
+	return (const nvm_region_t*) gp_nvm_region;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Place all regions back to back on memory driver
+*
+* @note		Must be called while NVM is not initialized. Regions of
+* 			driver with known flash page are rounded up to it.
+*
+* @param[in]	drv			- Memory driver of all regions
+* @param[in]	region_size	- Size of each region in bytes
+* @return 		valid		- Layout fits simulated memory
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nvm_cfg_set_layout(const nvm_mem_drv_name_t drv, const uint32_t region_size)
+{
+	uint32_t	stride	= region_size;
+	bool		valid	= false;
+
+	if ( 0U != g_mem_driver[drv].page_size )
+	{
+		stride = ((( region_size + NVM_BENCH_PAGE_SIZE - 1U ) / NVM_BENCH_PAGE_SIZE ) * NVM_BENCH_PAGE_SIZE );
+	}
+
+	if ((uint64_t) stride * eNVM_REGION_NUM_OF <= NVM_SIM_SIZE )
+	{
+		free( gp_nvm_region );
+		gp_nvm_region = malloc( eNVM_REGION_NUM_OF * sizeof( nvm_region_t ));
+
+		if ( NULL != gp_nvm_region )
+		{
+			for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+			{
+				// Region members are constant, so table entry is copied in whole
+				const nvm_region_t entry =
+				{
+					.name		= "Bench",
+					.start_addr	= ( region * stride ),
+					.size		= region_size,
+					.p_driver	= &g_mem_driver[drv],
+					.crc_en		= false,
+					.ab_en		= false,
+				};
+
+				memcpy( &gp_nvm_region[region], &entry, sizeof( nvm_region_t ));
+			}
+
+			valid = true;
+		}
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of low level read, write and erase calls
+*
+* @return	calls - Number of calls since last reset
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nvm_cfg_get_drv_calls(void)
+{
+	return g_drv_calls;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset number of low level read, write and erase calls
+*
+* @return	void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_cfg_reset_drv_calls(void)
+{
+	g_drv_calls = 0U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,364 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_cfg.h
+*@brief     Non-Volatile memory configuration file of benchmark
+*@author    Ziga Miklosic
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_CFG
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _NVM_CFG_H_
+#define _NVM_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// USER CODE BEGIN...
+
+#include <stdio.h>
+#include <assert.h>
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// USER CODE BEGIN...
+
+/**
+ * 	Number of benchmarked regions
+ *
+ * 	@note	Region table is compile time, so each region count is
+ * 			separate benchmark build.
+ */
+#ifndef NVM_BENCH_REGION_NUM
+	#define NVM_BENCH_REGION_NUM				( 4 )
+#endif
+
+// USER CODE END...
+
+/**
+ * 	NVM Region options
+ *
+ * 	@note 	Must always start with 0!
+ */
+typedef enum
+{
+	// USER CODE BEGIN...
+
+	eNVM_REGION_BENCH_FIRST = 0,					/**<First benchmarked region, others follow */
+
+	// USER CODE END...
+
+	eNVM_REGION_NUM_OF = NVM_BENCH_REGION_NUM
+} nvm_region_name_t;
+
+/**
+ * 	NVM Low-level memory drivers
+ *
+ * 	@note 	Must always start with 0!
+ */
+typedef enum
+{
+	// USER CODE BEGIN...
+
+	eNVM_MEM_DRV_BENCH_EE = 0,		/**<Simulated flash with EEPROM emulation */
+	eNVM_MEM_DRV_BENCH_DIRECT,		/**<Simulated EEPROM accessed directly */
+	eNVM_MEM_DRV_CHECK_EE_RAW,		/**<Simulated flash with EEPROM emulation, page size unknown. Used by checks only. */
+
+	// USER CODE END...
+
+	eNVM_MEM_DRV_NUM_OF
+} nvm_mem_drv_name_t;
+
+
+// USER CODE START...
+
+/**
+ * 	Enable/Disable multiple access protection
+ */
+#define NVM_CFG_MUTEX_EN						( 1 )
+
+/**
+ * 	Enable/Disable per memory driver locking
+ *
+ * 	@note	When enabled read, write and erase lock only memory driver of
+ * 			region, thus regions of different drivers can be accessed
+ * 			concurrently. Sync additionally takes global mutex. Has no
+ * 			effect if NVM_CFG_MUTEX_EN is 0.
+ */
+#define NVM_CFG_MUTEX_PER_DRV_EN				( 0 )
+
+/**
+ * 	EEPROM emulation dirty tracking block size in bytes
+ *
+ * 	@note	Each write/erase to EEPROM emulated region marks touched
+ * 			blocks as dirty. Sync of region without dirty blocks
+ * 			has no effect on flash.
+ */
+#define NVM_CFG_EE_BLOCK_SIZE					( 64U )
+
+/**
+ * 	Enable/Disable static RAM space for EEPROM emulation
+ *
+ * 	@note	When enabled RAM space of NVM_CFG_EE_RAM_SIZE bytes is
+ * 			statically allocated, otherwise it is allocated from heap
+ * 			at initialization.
+ */
+#define NVM_CFG_EE_STATIC_RAM_EN				( 0 )
+
+/**
+ * 	Size of static RAM space for EEPROM emulation in bytes
+ *
+ * 	@note	Must be at least sum of sizes of all EEPROM emulated regions!
+ */
+#define NVM_CFG_EE_RAM_SIZE						( 0x500U )
+
+/**
+ * 	Enable/Disable lazy load of EEPROM emulated regions
+ *
+ * 	@note	When enabled region is copied from flash to RAM at first
+ * 			access (or by nvm_prefetch()) instead of at initialization.
+ */
+#define NVM_CFG_EE_LAZY_LOAD_EN					( 0 )
+
+/**
+ * 	EEPROM emulation flash page buffer size in bytes
+ *
+ * 	@note	Buffer is used to sync region that shares flash page with
+ * 			other data. Must be at least page size of such memory driver.
+ * 			Set to 0 when all EEPROM emulated regions are page aligned.
+ */
+#define NVM_CFG_EE_PAGE_BUF_SIZE				( 0x1000U )
+
+/**
+ * 	Enable/Disable asynchronous sync
+ *
+ * 	@note	Sync requests are executed by nvm_process(). Requires
+ * 			nvm_if_sync_request() to be provided by interface.
+ */
+#define NVM_CFG_SYNC_ASYNC_EN					( 0 )
+
+/**
+ * 	Number of bytes programmed per sync step
+ *
+ * 	@note	Bounds duration of single nvm_sync_step() / nvm_process() step.
+ * 			Must be multiple of driver programming unit. Set to 0 to
+ * 			program complete flash page in single step.
+ */
+#define NVM_CFG_EE_SYNC_CHUNK_SIZE				( 0x200U )
+
+/**
+ * 	Enable/Disable program-only sync of in-place EEPROM emulation
+ *
+ * 	@note	Used by memory drivers with "prog_only_en" set. When every
+ * 			changed bit goes 1->0 only dirty blocks are programmed and
+ * 			flash page is not erased.
+ */
+#define NVM_CFG_EE_PROG_ONLY_EN					( 0 )
+
+/**
+ * 	Enable/Disable A/B (double buffered) commit of EEPROM emulated regions
+ *
+ * 	@note	Used by regions with "ab_en" set. Region occupies two flash
+ * 			slots; sync writes inactive slot and commits it by its footer,
+ * 			so power loss during sync keeps previous content.
+ */
+#define NVM_CFG_EE_AB_EN						( 0 )
+
+/**
+ * 	Enable/Disable lock-free (seqlock) reads of EEPROM emulated regions
+ *
+ * 	@note	Reads copy data from RAM without taking NVM mutex and are
+ * 			retried if write raced them. Requires C11 <stdatomic.h>.
+ */
+#define NVM_CFG_EE_SEQLOCK_EN					( 0 )
+
+/**
+ * 	Number of lock-free read attempts before falling back to locked read
+ */
+#define NVM_CFG_EE_SEQLOCK_RETRY				( 4U )
+
+/**
+ * 	Batch operation staging buffer size in bytes
+ *
+ * 	@note	Adjacent batch items with non-adjacent data buffers are
+ * 			coalesced into single driver call up to that size. Set to 0
+ * 			to coalesce only items with adjacent data buffers.
+ */
+#define NVM_CFG_BATCH_BUF_SIZE					( 0x100U )
+
+/**
+ * 	Enable/Disable integrity trailer (CRC32) of regions
+ *
+ * 	@note	Used by regions with "crc_en" set. Last NVM_CRC_SIZE bytes
+ * 			of such region are reserved for CRC.
+ */
+#define NVM_CFG_CRC_EN							( 0 )
+
+/**
+ * 	Enable/Disable slicing-by-4 CRC calculation
+ *
+ * 	@note	Processes 4 bytes per step using 4 kB of lookup tables,
+ * 			otherwise byte by byte using 1 kB table.
+ */
+#define NVM_CFG_CRC_SLICE_BY_4_EN				( 1 )
+
+/**
+ * 	CRC block size in bytes
+ *
+ * 	@note	Region CRC is built from CRCs of blocks of this size, so
+ * 			that write only rehashes blocks it touched. EEPROM emulated
+ * 			regions keep 4 bytes of RAM per block.
+ */
+#define NVM_CFG_CRC_BLOCK_SIZE					( 64U )
+
+/**
+ * 	Enable/Disable skipping of unchanged writes
+ *
+ * 	@note	nvm_write() compares data with RAM mirror of EEPROM emulated
+ * 			region or reads back non-emulated memory. Write of already
+ * 			stored data is dropped without sync or program cycle.
+ */
+#define NVM_CFG_WRITE_SKIP_EN					( 0 )
+
+/**
+ * 	Read-back buffer size in bytes for compare of non-emulated memory
+ *
+ * 	@note	Allocated on stack of nvm_write() caller.
+ */
+#define NVM_CFG_WRITE_SKIP_BUF_SIZE				( 32U )
+
+/**
+ * 	Enable/Disable write coalescing cache of non-emulated memory drivers
+ *
+ * 	@note	Used by memory drivers with "wcache_en" set.
+ */
+#define NVM_CFG_WCACHE_EN						( 0 )
+
+/**
+ * 	Write cache page size in bytes
+ *
+ * 	@note	Must be at least "page_size" of largest cached memory driver.
+ */
+#define NVM_CFG_WCACHE_SIZE						( 0x100U )
+
+/**
+ * 	Enable/Disable read cache of non-emulated memory drivers
+ *
+ * 	@note	Used by memory drivers with "rcache_en" set. Each memory
+ * 			driver has its own pool of blocks.
+ */
+#define NVM_CFG_RCACHE_EN						( 0 )
+
+/**
+ * 	Read cache block size in bytes
+ */
+#define NVM_CFG_RCACHE_BLOCK_SIZE				( 32U )
+
+/**
+ * 	Number of read cache blocks per memory driver
+ */
+#define NVM_CFG_RCACHE_BLOCK_NUM				( 8U )
+
+/**
+ * 	Enable/Disable asynchronous (DMA) read and write
+ *
+ * 	@note	Transfers of memory drivers providing asynchronous functions
+ * 			are started in background and completed by nvm_process().
+ */
+#define NVM_CFG_ASYNC_EN						( 0 )
+
+/**
+ * 	Number of queued asynchronous requests per memory driver
+ */
+#define NVM_CFG_ASYNC_QUEUE_SIZE				( 4U )
+
+/**
+ * 	Enable/Disable performance counters
+ *
+ * 	@note	Per region counters of operations, memory driver calls, erased
+ * 			pages, latency and mutex wait. Time is taken from
+ * 			nvm_if_get_timestamp() provided by user.
+ */
+#define NVM_CFG_STATS_EN						( 0 )
+
+/**
+ * 	Number of pages per region with own erase counter
+ */
+#define NVM_CFG_STATS_PAGE_NUM					( 8U )
+
+/**
+ * 	Enable/Disable trace of NVM operations
+ *
+ * 	@note	Operations are recorded as binary events into ring buffer
+ * 			instead of being printed in debug mode. Timestamp of event is
+ * 			taken from nvm_if_get_timestamp() provided by user.
+ */
+#define NVM_CFG_TRACE_EN						( 0 )
+
+/**
+ * 	Number of trace events kept, must be power of two
+ */
+#define NVM_CFG_TRACE_SIZE						( 64U )
+
+/**
+ * 	Enable/Disable debug mode
+ */
+#define NVM_CFG_DEBUG_EN						( 0 )
+
+/**
+ * 	Enable/Disable assertions
+ */
+#define NVM_CFG_ASSERT_EN						( 0 )
+
+/**
+ * 	Debug communication port macros
+ */
+#if ( 1 == NVM_CFG_DEBUG_EN )
+	#define NVM_DBG_PRINT( ... )				( printf( __VA_ARGS__ ))
+#else
+	#define NVM_DBG_PRINT( ... )				{ ; }
+
+#endif
+
+/**
+ * 	 Assertion macros
+ */
+#if ( 1 == NVM_CFG_ASSERT_EN )
+	#define NVM_ASSERT(x)						assert(x)
+#else
+	#define NVM_ASSERT(x)						{ ; }
+#endif
+
+// USER CODE END
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+const void * nvm_cfg_get_drivers(void);
+const void * nvm_cfg_get_regions(void);
+
+// USER CODE BEGIN...
+
+bool		nvm_cfg_set_layout		(const nvm_mem_drv_name_t drv, const uint32_t region_size);
+uint32_t	nvm_cfg_get_drv_calls	(void);
+void		nvm_cfg_reset_drv_calls	(void);
+
+// USER CODE END...
+
+#endif // _NVM_CFG_H_
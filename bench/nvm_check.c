@@ -0,0 +1,200 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_check.c
+*@brief     NVM behaviour checks on simulated memory driver
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_CHECK
+* @{ <!-- BEGIN GROUP -->
+*
+*   Drives public NVM API against simulated flash and compares flash
+*   content with expected one. Prints failed checks and exits with
+*   failure if any of them failed.
+*
+*   Checks:
+*       - in-place sync (unknown page size) keeps neighbouring region in
+*         other flash page untouched and dirty
+*       - in-place sync restores neighbouring region wiped by erase
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nvm_cfg.h"
+#include "nvm/src/nvm.h"
+#include "nvm/sim/nvm_sim.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Neighbouring regions A and B
+ */
+#define NVM_CHECK_REGION_A          ((nvm_region_name_t) 0 )
+#define NVM_CHECK_REGION_B          ((nvm_region_name_t) 1 )
+
+/**
+ *  Size of checked data, spans multiple dirty blocks
+ */
+#define NVM_CHECK_DATA_SIZE         ( 0x100U )
+
+NVM_STATIC_ASSERT( eNVM_REGION_NUM_OF >= 2, "Checks need at least two regions!" );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Simulated NOR flash
+ */
+static const nvm_sim_cfg_t g_sim_cfg = { .flash_en = true };
+
+/**
+ *  Number of failed checks
+ */
+static uint32_t g_fail_num = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Record result of single check
+*
+* @param[in]	ok      - Check passed
+* @param[in]	p_what  - Check description
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_check_expect(const bool ok, const char * const p_what)
+{
+    if ( false == ok )
+    {
+        fprintf( stderr, "nvm_check: FAIL %s\n", p_what );
+        g_fail_num++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check flash content of region start
+*
+* @param[in]	region  - NVM region name
+* @param[in]	value   - Expected value of each byte
+* @return 		equal   - Flash holds expected value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_check_flash(const nvm_region_name_t region, const uint8_t value)
+{
+    const nvm_region_t *    p_regions   = nvm_cfg_get_regions();
+    const uint8_t *         p_flash     = &nvm_sim_get_mem()[ p_regions[region].start_addr ];
+    bool                    equal       = true;
+
+    for ( uint32_t i = 0U; i < NVM_CHECK_DATA_SIZE; i++ )
+    {
+        equal &= ( value == p_flash[i] );
+    }
+
+    return equal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sync neighbour B while region A holds unsynced data
+*
+* @note     Old content of A programmed over by new one would be their
+*           AND (0x55 & 0xAA = 0x00).
+*
+* @param[in]	region_size - Size of each region
+* @param[in]	a_value     - Expected flash content of A after sync of B
+* @param[in]	a_dirty     - A expected to stay dirty after sync of B
+* @param[in]	p_what      - Check description
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_check_sync_neighbour(const uint32_t region_size, const uint8_t a_value, const bool a_dirty, const char * const p_what)
+{
+    uint8_t         data[NVM_CHECK_DATA_SIZE];
+    nvm_sim_stats_t stats = { 0 };
+
+    printf( "nvm_check: %s\n", p_what );
+
+    nvm_check_expect( nvm_cfg_set_layout( eNVM_MEM_DRV_CHECK_EE_RAW, region_size ), "layout fits" );
+
+    nvm_sim_set_cfg( &g_sim_cfg );
+    nvm_check_expect( eNVM_OK == nvm_sim_erase( 0U, NVM_SIM_SIZE ), "erase of memory" );
+    nvm_check_expect( eNVM_OK == nvm_init(), "nvm_init" );
+
+    // Old content of A in flash
+    memset( data, 0x55U, sizeof( data ));
+    nvm_check_expect( eNVM_OK == nvm_write( NVM_CHECK_REGION_A, 0U, sizeof( data ), data ), "write of A" );
+    nvm_check_expect( eNVM_OK == nvm_sync( NVM_CHECK_REGION_A ), "sync of A" );
+
+    // New content of A only in RAM
+    memset( data, 0xAAU, sizeof( data ));
+    nvm_check_expect( eNVM_OK == nvm_write( NVM_CHECK_REGION_A, 0U, sizeof( data ), data ), "write of A" );
+
+    memset( data, 0x11U, sizeof( data ));
+    nvm_check_expect( eNVM_OK == nvm_write( NVM_CHECK_REGION_B, 0U, sizeof( data ), data ), "write of B" );
+    nvm_check_expect( eNVM_OK == nvm_sync( NVM_CHECK_REGION_B ), "sync of B" );
+
+    nvm_check_expect( true == nvm_check_flash( NVM_CHECK_REGION_B, 0x11U ), "flash of B after sync of B" );
+    nvm_check_expect( true == nvm_check_flash( NVM_CHECK_REGION_A, a_value ), "flash of A after sync of B" );
+
+    // Sync of A programs flash only while A is dirty
+    nvm_sim_reset_stats();
+    nvm_check_expect( eNVM_OK == nvm_sync( NVM_CHECK_REGION_A ), "sync of A" );
+    nvm_sim_get_stats( &stats );
+
+    nvm_check_expect( a_dirty == ( stats.prog_bytes > 0U ), "dirty state of A after sync of B" );
+    nvm_check_expect( true == nvm_check_flash( NVM_CHECK_REGION_A, 0xAAU ), "flash of A after sync of A" );
+
+    // All regions synced
+    nvm_check_expect( eNVM_OK == nvm_deinit(), "nvm_deinit" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run checks
+*
+* @return 		exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    // Erase of B leaves A untouched, A is synced later on its own
+    nvm_check_sync_neighbour( NVM_SIM_PAGE_SIZE, 0x55U, true, "in-place sync, neighbour in other page" );
+
+    // Erase of B wipes A, which is restored from RAM
+    nvm_check_sync_neighbour(( NVM_SIM_PAGE_SIZE / 4U ), 0xAAU, false, "in-place sync, neighbour in shared page" );
+
+    if ( 0U == g_fail_num )
+    {
+        printf( "nvm_check: all passed\n" );
+    }
+
+    return (( 0U == g_fail_num ) ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,246 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_if.c
+*@brief     Non-Volatile memory interface of benchmark
+*@author    Ziga Miklosic
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM IF
+* @{ <!-- BEGIN GROUP -->
+*
+*
+* 	Put code that is platform depended inside code block start with
+* 	"USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "nvm_if.h"
+
+// USER CODE BEGIN...
+
+#include <time.h>
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// USER DEFINITIONS BEGIN...
+
+
+// USER DEFINITIONS END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// USER VARIABLES BEGIN...
+
+
+// USER VARIABLES END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize low level interface
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+* @return 		status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_init(void)
+{
+	nvm_status_t status = eNVM_OK;
+
+	// USER CODE BEGIN...
+
+	// USER CODE END...
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire mutex
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+*		If not being used leave empty.
+*
+*		This function does not have an affect if "NVM_CFG_MUTEX_EN"
+* 		is set to 0.
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_aquire_mutex(void)
+{
+	nvm_status_t status = eNVM_OK;
+
+	// USER CODE BEGIN...
+
+	// USER CODE END...
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release mutex
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+*		If not being used leave empty.
+*
+*		This function does not have an affect if "NVM_CFG_MUTEX_EN"
+* 		is set to 0.
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_release_mutex(void)
+{
+	nvm_status_t status = eNVM_OK;
+
+	// USER CODE BEGIN...
+
+	// USER CODE END...
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire memory driver mutex
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+*		Each memory driver shall have its own mutex. Global mutex is taken
+*		before memory driver mutex, never after it.
+*
+*		This function does not have an affect if "NVM_CFG_MUTEX_EN" or
+* 		"NVM_CFG_MUTEX_PER_DRV_EN" is set to 0.
+*
+* @param[in]	drv		- Memory driver
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_aquire_drv_mutex(const nvm_mem_drv_name_t drv)
+{
+	nvm_status_t status = eNVM_OK;
+
+	// USER CODE BEGIN...
+
+	// Single threaded benchmark
+	(void) drv;
+
+	// USER CODE END...
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release memory driver mutex
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+*		This function does not have an affect if "NVM_CFG_MUTEX_EN" or
+* 		"NVM_CFG_MUTEX_PER_DRV_EN" is set to 0.
+*
+* @param[in]	drv		- Memory driver
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_release_drv_mutex(const nvm_mem_drv_name_t drv)
+{
+	nvm_status_t status = eNVM_OK;
+
+	// USER CODE BEGIN...
+
+	// Single threaded benchmark
+	(void) drv;
+
+	// USER CODE END...
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Notify about new asynchronous sync request
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+*		Intended to wake up worker task that calls nvm_process(). If
+*		nvm_process() is polled from main loop leave empty.
+*
+*		This function does not have an affect if "NVM_CFG_SYNC_ASYNC_EN"
+* 		is set to 0.
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_sync_request(void)
+{
+	nvm_status_t status = eNVM_OK;
+
+	// USER CODE BEGIN...
+
+	// USER CODE END...
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get timestamp
+*
+* @note	User shall provide definition of that function based on used platform!
+*
+*		Shall return free running counter, e.g. microseconds or CPU cycles.
+*		Counter may wrap around, differences are calculated unsigned.
+*
+*		This function does not have an affect if "NVM_CFG_STATS_EN"
+* 		and "NVM_CFG_TRACE_EN" are set to 0.
+*
+* @return 		timestamp - Current timestamp
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nvm_if_get_timestamp(void)
+{
+	uint32_t timestamp = 0U;
+
+	// USER CODE BEGIN...
+
+	struct timespec now;
+
+	if ( 0 == clock_gettime( CLOCK_MONOTONIC, &now ))
+	{
+		timestamp = (uint32_t)(( now.tv_sec * 1000000LL ) + ( now.tv_nsec / 1000L ));
+	}
+
+	// USER CODE END...
+
+	return timestamp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
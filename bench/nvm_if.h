@@ -0,0 +1,42 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_if.h
+*@brief     Non-Volatile memory interface file of benchmark
+*@author    Ziga Miklosic
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_IF
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _NVM_IF_H_
+#define _NVM_IF_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "nvm/src/nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_if_init			(void);
+nvm_status_t nvm_if_aquire_mutex	(void);
+nvm_status_t nvm_if_release_mutex	(void);
+nvm_status_t nvm_if_sync_request	(void);
+nvm_status_t nvm_if_aquire_drv_mutex	(const nvm_mem_drv_name_t drv);
+nvm_status_t nvm_if_release_drv_mutex	(const nvm_mem_drv_name_t drv);
+uint32_t     nvm_if_get_timestamp	(void);
+
+#endif // _NVM_CFG_H_
@@ -0,0 +1,718 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_sim.c
+*@brief     NVM simulated memory driver for host
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+*   RAM backed memory driver for host builds.
+*
+*   Simulates EEPROM (write overwrites, erase sets bytes to 0xFF) or, with
+*   "flash_en" in nvm_sim_set_cfg(), NOR flash: program only clears bits
+*   and erase sets whole pages of NVM_SIM_PAGE_SIZE to 0xFF.
+*
+*   Each operation advances simulated time by configured latency and
+*   erase of page (EEPROM: write or erase touching page) increments wear
+*   counter of page. Power loss can be injected after any number of
+*   programmed or erased bytes: operation stops at that byte and memory
+*   refuses all access until re-initialization (reset).
+*
+*   Content can be saved to and loaded from file to carry it over process
+*   restart.
+*
+*   Asynchronous transfer
+*   behaves as DMA: it is started by nvm_sim_write_async/nvm_sim_read_async,
+*   data are moved and completion is reported to NVM by next nvm_sim_tick(),
+*   which stands for DMA transfer complete interrupt.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "nvm_sim.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated asynchronous transfer
+ */
+typedef struct
+{
+    uint8_t *   p_data;     /**<Data buffer */
+    uint32_t    addr;       /**<Memory address */
+    uint32_t    size;       /**<Size in bytes */
+    bool        write;      /**<Write or read transfer */
+    bool        active;     /**<Transfer in flight */
+} nvm_sim_xfer_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated memory
+ */
+static uint8_t g_sim_mem[NVM_SIM_SIZE] = { 0 };
+
+/**
+ * 	Transfer in flight
+ */
+static nvm_sim_xfer_t g_sim_xfer = { 0 };
+
+/**
+ * 	Memory behaviour
+ */
+static nvm_sim_cfg_t g_sim_cfg = { 0 };
+
+/**
+ * 	Statistics
+ */
+static nvm_sim_stats_t g_sim_stats = { 0 };
+
+/**
+ * 	Wear (erase cycle) counters of pages
+ */
+static uint32_t g_sim_wear[NVM_SIM_PAGE_NUM] = { 0 };
+
+/**
+ * 	Number of bytes to program or erase before power loss
+ */
+static uint32_t g_sim_power_budget = NVM_SIM_POWER_LOSS_OFF;
+
+/**
+ * 	Power is lost, memory does not respond until reset
+ */
+static bool gb_sim_power_lost = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool         nvm_sim_is_valid    (const uint32_t addr, const uint32_t size);
+static uint32_t     nvm_sim_consume     (const uint32_t size);
+static void         nvm_sim_wear_page   (const uint32_t page);
+static nvm_status_t nvm_sim_program     (const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+static void         nvm_sim_fetch       (const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+static nvm_status_t nvm_sim_erase_range (const uint32_t addr, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check range of simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @return 		valid	- Range is inside simulated memory
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_sim_is_valid(const uint32_t addr, const uint32_t size)
+{
+    return  (   ( size <= NVM_SIM_SIZE )
+            &&  ( addr <= ( NVM_SIM_SIZE - size ))
+            &&  ( false == gb_sim_power_lost ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Consume power loss budget
+*
+* @param[in]	size	- Number of bytes to be programmed or erased
+* @return 		done	- Number of bytes done before power loss
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_sim_consume(const uint32_t size)
+{
+    uint32_t done = size;
+
+    if ( NVM_SIM_POWER_LOSS_OFF != g_sim_power_budget )
+    {
+        if ( size >= g_sim_power_budget )
+        {
+            done                = g_sim_power_budget;
+            g_sim_power_budget  = NVM_SIM_POWER_LOSS_OFF;
+            gb_sim_power_lost   = true;
+        }
+        else
+        {
+            g_sim_power_budget -= size;
+        }
+    }
+
+    return done;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Count erase cycle of page
+*
+* @param[in]	page	- Page number
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_sim_wear_page(const uint32_t page)
+{
+    g_sim_wear[page]++;
+
+    if ( g_sim_wear[page] > g_sim_stats.wear_max )
+    {
+        g_sim_stats.wear_max = g_sim_wear[page];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program simulated memory
+*
+* @note     Flash can only clear bits, program of bit from 0 to 1 fails.
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Data to write
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_sim_program(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    nvm_status_t    status  = eNVM_OK;
+    const uint32_t  done    = nvm_sim_consume( size );
+
+    if ( true == g_sim_cfg.flash_en )
+    {
+        for ( uint32_t i = 0U; i < done; i++ )
+        {
+            g_sim_mem[ addr + i ] &= p_data[i];
+
+            if ( g_sim_mem[ addr + i ] != p_data[i] )
+            {
+                status = eNVM_ERROR;
+            }
+        }
+    }
+    else
+    {
+        memcpy( &g_sim_mem[addr], p_data, done );
+
+        // EEPROM write is erase and program cycle
+        if ( done > 0U )
+        {
+            for ( uint32_t page = ( addr / NVM_SIM_PAGE_SIZE ); page <= (( addr + done - 1U ) / NVM_SIM_PAGE_SIZE ); page++ )
+            {
+                nvm_sim_wear_page( page );
+            }
+        }
+    }
+
+    g_sim_stats.time_ns     += ( g_sim_cfg.prog_ns + ((uint64_t) done * g_sim_cfg.prog_byte_ns ));
+    g_sim_stats.prog_num    += 1U;
+    g_sim_stats.prog_bytes  += done;
+
+    if ( true == gb_sim_power_lost )
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_sim_fetch(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    memcpy( p_data, &g_sim_mem[addr], size );
+
+    g_sim_stats.time_ns     += ( g_sim_cfg.read_ns + ((uint64_t) size * g_sim_cfg.read_byte_ns ));
+    g_sim_stats.read_num    += 1U;
+    g_sim_stats.read_bytes  += size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase simulated memory page by page
+*
+* @note     Flash erases all pages touched by range, EEPROM only the range.
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_sim_erase_range(const uint32_t addr, const uint32_t size)
+{
+    nvm_status_t    status  = eNVM_OK;
+    uint32_t        start   = addr;
+    uint32_t        end     = ( addr + size );
+    uint32_t        chunk   = 0U;
+    uint32_t        done    = 0U;
+
+    if ( true == g_sim_cfg.flash_en )
+    {
+        start   = (( start / NVM_SIM_PAGE_SIZE ) * NVM_SIM_PAGE_SIZE );
+        end     = ((( end + NVM_SIM_PAGE_SIZE - 1U ) / NVM_SIM_PAGE_SIZE ) * NVM_SIM_PAGE_SIZE );
+
+        if ( end > NVM_SIM_SIZE )
+        {
+            end = NVM_SIM_SIZE;
+        }
+    }
+
+    for ( uint32_t a = start; ( a < end ) && ( false == gb_sim_power_lost ); a += chunk )
+    {
+        // Till end of page
+        chunk = ((( a / NVM_SIM_PAGE_SIZE ) + 1U ) * NVM_SIM_PAGE_SIZE ) - a;
+
+        if ( chunk > ( end - a ))
+        {
+            chunk = ( end - a );
+        }
+
+        done = nvm_sim_consume( chunk );
+        memset( &g_sim_mem[a], 0xFF, done );
+
+        nvm_sim_wear_page( a / NVM_SIM_PAGE_SIZE );
+
+        g_sim_stats.time_ns     += g_sim_cfg.erase_ns;
+        g_sim_stats.erase_num   += 1U;
+    }
+
+    if ( true == gb_sim_power_lost )
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_SIM_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM simulated memory driver API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize simulated memory
+*
+* @note     Memory content is kept, so re-initialization simulates reset.
+*           It also restores power after injected power loss.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_init(void)
+{
+    // Transfer is lost on reset
+    g_sim_xfer.active = false;
+    gb_sim_power_lost = false;
+
+    return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		De-initialize simulated memory
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_deinit(void)
+{
+    g_sim_xfer.active = false;
+
+    return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write to simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Data to write
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    nvm_status_t status = eNVM_OK;
+
+    if  (   ( true == nvm_sim_is_valid( addr, size ))
+        &&  ( NULL != p_data )
+        &&  ( false == g_sim_xfer.active ))
+    {
+        status = nvm_sim_program( addr, size, p_data );
+    }
+    else
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read from simulated memory
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    nvm_status_t status = eNVM_OK;
+
+    if  (   ( true == nvm_sim_is_valid( addr, size ))
+        &&  ( NULL != p_data )
+        &&  ( false == g_sim_xfer.active ))
+    {
+        nvm_sim_fetch( addr, size, p_data );
+    }
+    else
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase simulated memory
+*
+* @note     Flash erases all pages touched by range.
+*
+* @param[in]	addr	- Memory address
+* @param[in]	size	- Size in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_erase(const uint32_t addr, const uint32_t size)
+{
+    nvm_status_t status = eNVM_OK;
+
+    if  (   ( true == nvm_sim_is_valid( addr, size ))
+        &&  ( false == g_sim_xfer.active ))
+    {
+        status = nvm_sim_erase_range( addr, size );
+    }
+    else
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get simulated memory content
+*
+* @note     Intended for inspection and preparation of memory content.
+*
+* @return 		p_mem	- Simulated memory of NVM_SIM_SIZE bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t * nvm_sim_get_mem(void)
+{
+    return (uint8_t*) &g_sim_mem;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set behaviour of simulated memory
+*
+* @note     Memory content is kept. Fresh flash shall be prepared to erased
+*           state (0xFF) via nvm_sim_get_mem().
+*
+* @param[in]	p_cfg	- Memory behaviour
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_sim_set_cfg(const nvm_sim_cfg_t * const p_cfg)
+{
+    if ( NULL != p_cfg )
+    {
+        g_sim_cfg = *p_cfg;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get statistics of simulated memory
+*
+* @param[out]	p_stats	- Statistics
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_sim_get_stats(nvm_sim_stats_t * const p_stats)
+{
+    if ( NULL != p_stats )
+    {
+        *p_stats = g_sim_stats;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get wear counter of page
+*
+* @param[in]	page	- Page number
+* @return 		cnt	    - Number of erase cycles of page
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nvm_sim_get_wear(const uint32_t page)
+{
+    uint32_t cnt = 0U;
+
+    if ( page < NVM_SIM_PAGE_NUM )
+    {
+        cnt = g_sim_wear[page];
+    }
+
+    return cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear statistics and wear counters
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_sim_reset_stats(void)
+{
+    memset( &g_sim_stats, 0, sizeof( g_sim_stats ));
+    memset( &g_sim_wear, 0, sizeof( g_sim_wear ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Inject power loss
+*
+* @brief    Power is lost after given number of further programmed or
+*           erased bytes. Operation in progress stops at that byte and
+*           fails, as do all following operations until nvm_sim_init().
+*
+* @param[in]	bytes	- Bytes to program or erase before power loss,
+*                         NVM_SIM_POWER_LOSS_OFF to disable injection
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_sim_set_power_loss(const uint32_t bytes)
+{
+    g_sim_power_budget = bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if injected power loss occurred
+*
+* @return 		lost	- Power is lost
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nvm_sim_is_power_lost(void)
+{
+    return gb_sim_power_lost;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Save simulated memory content to file
+*
+* @param[in]	p_path	- File path
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_save(const char * const p_path)
+{
+    nvm_status_t    status  = eNVM_ERROR;
+    FILE *          p_file  = fopen( p_path, "wb" );
+
+    if ( NULL != p_file )
+    {
+        if ( NVM_SIM_SIZE == fwrite( &g_sim_mem, 1U, NVM_SIM_SIZE, p_file ))
+        {
+            status = eNVM_OK;
+        }
+
+        (void) fclose( p_file );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load simulated memory content from file
+*
+* @param[in]	p_path	- File path
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sim_load(const char * const p_path)
+{
+    nvm_status_t    status  = eNVM_ERROR;
+    FILE *          p_file  = fopen( p_path, "rb" );
+
+    if ( NULL != p_file )
+    {
+        if ( NVM_SIM_SIZE == fread( &g_sim_mem, 1U, NVM_SIM_SIZE, p_file ))
+        {
+            status = eNVM_OK;
+        }
+
+        (void) fclose( p_file );
+    }
+
+    return status;
+}
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Start asynchronous write to simulated memory
+    *
+    * @param[in]	addr	- Memory address
+    * @param[in]	size	- Size in bytes
+    * @param[in]	p_data	- Data to write. Must be valid until completion.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_sim_write_async(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        if  (   ( true == nvm_sim_is_valid( addr, size ))
+            &&  ( NULL != p_data )
+            &&  ( false == g_sim_xfer.active ))
+        {
+            g_sim_xfer.p_data   = (uint8_t*) p_data;
+            g_sim_xfer.addr     = addr;
+            g_sim_xfer.size     = size;
+            g_sim_xfer.write    = true;
+            g_sim_xfer.active   = true;
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Start asynchronous read from simulated memory
+    *
+    * @param[in]	addr	- Memory address
+    * @param[in]	size	- Size in bytes
+    * @param[out]	p_data	- Read data. Valid after completion.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_sim_read_async(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        if  (   ( true == nvm_sim_is_valid( addr, size ))
+            &&  ( NULL != p_data )
+            &&  ( false == g_sim_xfer.active ))
+        {
+            g_sim_xfer.p_data   = p_data;
+            g_sim_xfer.addr     = addr;
+            g_sim_xfer.size     = size;
+            g_sim_xfer.write    = false;
+            g_sim_xfer.active   = true;
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Complete asynchronous transfer in flight
+    *
+    * @brief    Moves data of transfer in flight and reports completion to
+    *           NVM via nvm_async_complete(). Stands for DMA transfer
+    *           complete interrupt, thus call it from test loop (or from
+    *           other thread) between nvm_process() calls.
+    *
+    * @return 		done	- Transfer was completed
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    bool nvm_sim_tick(void)
+    {
+        bool            done    = false;
+        nvm_status_t    status  = eNVM_OK;
+
+        if ( true == g_sim_xfer.active )
+        {
+            if ( true == g_sim_xfer.write )
+            {
+                status = nvm_sim_program( g_sim_xfer.addr, g_sim_xfer.size, g_sim_xfer.p_data );
+            }
+            else
+            {
+                nvm_sim_fetch( g_sim_xfer.addr, g_sim_xfer.size, g_sim_xfer.p_data );
+            }
+
+            g_sim_xfer.active = false;
+            done = true;
+
+            nvm_async_complete( NVM_SIM_DRV, status );
+        }
+
+        return done;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
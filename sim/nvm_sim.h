@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_sim.h
+*@brief     NVM simulated memory driver for host
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_SIM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_SIM_H
+#define __NVM_SIM_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../src/nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of simulated memory in bytes
+ */
+#ifndef NVM_SIM_SIZE
+    #define NVM_SIM_SIZE            ( 0x10000U )
+#endif
+
+/**
+ * 	Memory driver name of simulated memory in NVM configuration table
+ *
+ * 	@note	Used to report completion of asynchronous transfers.
+ */
+#ifndef NVM_SIM_DRV
+    #define NVM_SIM_DRV             ((nvm_mem_drv_name_t) 0 )
+#endif
+
+/**
+ * 	Page size of simulated memory in bytes
+ *
+ * 	@note	Unit of flash erase and of wear counters.
+ */
+#ifndef NVM_SIM_PAGE_SIZE
+    #define NVM_SIM_PAGE_SIZE       ( 0x1000U )
+#endif
+
+/**
+ * 	Number of pages of simulated memory
+ */
+#define NVM_SIM_PAGE_NUM            (( NVM_SIM_SIZE + NVM_SIM_PAGE_SIZE - 1U ) / NVM_SIM_PAGE_SIZE )
+
+/**
+ * 	Power loss injection disabled
+ */
+#define NVM_SIM_POWER_LOSS_OFF      ( 0xFFFFFFFFU )
+
+/**
+ * 	Simulated memory behaviour
+ *
+ * 	@note	Zero initialized configuration is EEPROM without latency.
+ */
+typedef struct
+{
+    bool        flash_en;       /**<Flash: program only clears bits (1->0) and erase works on whole pages. Otherwise EEPROM: write overwrites. */
+    uint32_t    read_ns;        /**<Latency of read operation */
+    uint32_t    read_byte_ns;   /**<Latency of each read byte */
+    uint32_t    prog_ns;        /**<Latency of write (program) operation */
+    uint32_t    prog_byte_ns;   /**<Latency of each written byte */
+    uint32_t    erase_ns;       /**<Latency of erase of single page */
+} nvm_sim_cfg_t;
+
+/**
+ * 	Simulated memory statistics
+ */
+typedef struct
+{
+    uint64_t    time_ns;        /**<Simulated time spent in memory operations */
+    uint32_t    read_num;       /**<Number of read operations */
+    uint32_t    read_bytes;     /**<Number of read bytes */
+    uint32_t    prog_num;       /**<Number of write operations */
+    uint32_t    prog_bytes;     /**<Number of written bytes */
+    uint32_t    erase_num;      /**<Number of erased pages */
+    uint32_t    wear_max;       /**<Highest wear counter of all pages */
+} nvm_sim_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t    nvm_sim_init        (void);
+nvm_status_t    nvm_sim_deinit      (void);
+nvm_status_t    nvm_sim_write       (const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t    nvm_sim_read        (const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+nvm_status_t    nvm_sim_erase       (const uint32_t addr, const uint32_t size);
+uint8_t *       nvm_sim_get_mem     (void);
+void            nvm_sim_set_cfg     (const nvm_sim_cfg_t * const p_cfg);
+void            nvm_sim_get_stats   (nvm_sim_stats_t * const p_stats);
+uint32_t        nvm_sim_get_wear    (const uint32_t page);
+void            nvm_sim_reset_stats (void);
+void            nvm_sim_set_power_loss  (const uint32_t bytes);
+bool            nvm_sim_is_power_lost   (void);
+nvm_status_t    nvm_sim_save        (const char * const p_path);
+nvm_status_t    nvm_sim_load        (const char * const p_path);
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+    nvm_status_t    nvm_sim_write_async (const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+    nvm_status_t    nvm_sim_read_async  (const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+    bool            nvm_sim_tick        (void);
+#endif
+
+#endif // __NVM_SIM_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
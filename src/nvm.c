@@ -24,9 +24,16 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "nvm.h"
 #include "nvm_ee.h"
+#include "nvm_drv.h"
+#include "nvm_wcache.h"
+#include "nvm_rcache.h"
+#include "nvm_crc.h"
+#include "nvm_stats.h"
+#include "nvm_trace.h"
 
 // Interface
 #include "../../nvm_if.h"
@@ -35,6 +42,93 @@
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * 	Per memory driver locking in use
+ */
+#define NVM_DRV_LOCK_EN         (( 1 == NVM_CFG_MUTEX_EN ) && ( 1 == NVM_CFG_MUTEX_PER_DRV_EN ))
+
+/**
+ * 	Batch operation
+ */
+typedef enum
+{
+    eNVM_BATCH_WRITE = 0,   /**<Write items */
+    eNVM_BATCH_READ,        /**<Read items */
+    eNVM_BATCH_ERASE,       /**<Erase items */
+} nvm_batch_op_t;
+
+/**
+ *  Maximum number of ranges of single vectored driver call issued by batch
+ */
+#define NVM_BATCH_VEC_MAX       ( 16U )
+
+/**
+ *  Size of buffer used to calculate CRC of non-emulated region
+ */
+#define NVM_CRC_BUF_SIZE        ( 32U )
+
+/**
+ * 	Asynchronous sync request
+ */
+typedef struct
+{
+    pf_nvm_sync_cb_t    pf_cb;      /**<Completion callback. Can be NULL */
+    nvm_status_t        status;     /**<Status of completed sync */
+    bool                pending;    /**<Sync queued or in progress */
+    bool                done;       /**<Sync completed, callback not yet reported */
+
+    #if ( 1 == NVM_CFG_STATS_EN )
+        uint32_t        ts;         /**<Timestamp of first request */
+    #endif
+} nvm_sync_req_t;
+
+#if ( 1 == NVM_CFG_CRC_EN )
+
+    /**
+     * 	Integrity state of non-emulated region
+     *
+     * 	@note	Trailer is checked once and result is kept. Writes make
+     * 			trailer stale, it is re-written at next sync.
+     */
+    typedef struct
+    {
+        bool checked;   /**<Integrity of region content is known */
+        bool ok;        /**<Trailer matched region content when checked */
+        bool stale;     /**<Region modified since trailer was written */
+    } nvm_crc_drv_state_t;
+
+#endif
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+
+    /**
+     * 	Asynchronous read/write request
+     */
+    typedef struct
+    {
+        pf_nvm_async_cb_t       pf_cb;      /**<Completion callback. Can be NULL */
+        uint8_t *               p_data;     /**<Data buffer */
+        nvm_region_name_t       region;     /**<NVM region */
+        uint32_t                addr;       /**<Start address inside region */
+        uint32_t                size;       /**<Size in bytes */
+        bool                    write;      /**<Write or read request */
+        volatile nvm_status_t   status;     /**<Status of completed transfer */
+        volatile bool           done;       /**<Transfer completed, callback not yet reported */
+    } nvm_async_req_t;
+
+    /**
+     * 	Asynchronous request queue of memory driver
+     */
+    typedef struct
+    {
+        nvm_async_req_t req[NVM_CFG_ASYNC_QUEUE_SIZE];  /**<Requests in order of arrival */
+        uint32_t        head;                           /**<Oldest request */
+        uint32_t        num;                            /**<Number of queued requests */
+        volatile bool   busy;                           /**<Transfer of oldest request started at memory driver */
+    } nvm_async_queue_t;
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +144,58 @@ static bool gb_is_init = false;
 static const nvm_region_t *     gp_nvm_regions = NULL;
 static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
 
-#if ( NVM_CFG_DEBUG_EN )
+#if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+
+    /**
+     *  Asynchronous sync requests
+     */
+    static nvm_sync_req_t g_sync_req[eNVM_REGION_NUM_OF] = { 0 };
+
+    /**
+     *  Region of sync in progress
+     */
+    static nvm_region_name_t g_sync_region = (nvm_region_name_t) 0;
+    static bool gb_sync_active = false;
+
+#endif
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+
+    /**
+     *  Asynchronous request queues
+     */
+    static nvm_async_queue_t g_async_queue[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+#endif
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+
+    /**
+     *  Number of skipped (unchanged) writes per memory driver
+     */
+    static uint32_t g_write_skip_cnt[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+#endif
+
+#if ( 1 == NVM_CFG_CRC_EN )
+
+    /**
+     *  Integrity state of non-emulated regions
+     */
+    static nvm_crc_drv_state_t g_crc_drv[eNVM_REGION_NUM_OF] = { 0 };
+
+#endif
+
+#if ( NVM_CFG_BATCH_BUF_SIZE > 0 )
+
+    /**
+     *  Staging buffer for coalesced batch transfers
+     */
+    static uint8_t g_batch_buf[NVM_CFG_BATCH_BUF_SIZE] = { 0 };
+
+#endif
+
+#if (( 1 == NVM_CFG_DEBUG_EN ) || ( 1 == NVM_CFG_TRACE_EN ))
 
 	/**
 	 * 	Status strings
@@ -59,6 +204,8 @@ static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
 	{
 		"OK",
 		"ERROR",
+		"ERROR_CRC",
+		"ERROR_BUSY",
 	};
 #endif
 
@@ -67,6 +214,57 @@ static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
 ////////////////////////////////////////////////////////////////////////////////
 static nvm_status_t nvm_check_config(void);
 
+static nvm_mem_drv_name_t nvm_get_drv(const nvm_region_name_t region);
+static uint32_t nvm_get_data_size(const nvm_region_name_t region);
+static uint32_t nvm_get_footprint(const nvm_region_name_t region);
+
+#if ( 1 == NVM_CFG_MUTEX_EN )
+    static nvm_status_t nvm_lock_drv        (const nvm_mem_drv_name_t drv);
+    static void         nvm_unlock_drv      (const nvm_mem_drv_name_t drv);
+    static nvm_status_t nvm_lock_region     (const nvm_region_name_t region);
+    static void         nvm_unlock_region   (const nvm_region_name_t region);
+    static nvm_status_t nvm_lock_batch      (const nvm_batch_item_t * const p_items, const uint32_t num, uint32_t * const p_locked);
+    static void         nvm_unlock_batch    (const uint32_t locked);
+#endif
+
+static nvm_status_t nvm_batch_check         (const nvm_batch_item_t * const p_item, const nvm_batch_op_t op);
+static bool         nvm_batch_has_v         (const nvm_mem_driver_t * const p_drv, const nvm_batch_op_t op);
+static uint32_t     nvm_batch_get_run       (const nvm_batch_item_t * const p_items, const uint32_t num, const uint32_t first, const nvm_batch_op_t op);
+static nvm_status_t nvm_batch_run_ee        (const nvm_batch_item_t * const p_item, const nvm_batch_op_t op);
+static nvm_status_t nvm_batch_run_v         (const nvm_batch_item_t * const p_items, const uint32_t first, const uint32_t last, const nvm_batch_op_t op);
+static nvm_status_t nvm_batch_run_adjacent  (const nvm_batch_item_t * const p_items, const uint32_t first, const uint32_t last, const nvm_batch_op_t op);
+static nvm_status_t nvm_batch_run           (nvm_batch_item_t * const p_items, const uint32_t first, const uint32_t last, const nvm_batch_op_t op);
+static nvm_status_t nvm_batch_execute       (nvm_batch_item_t * const p_items, const uint32_t num, const nvm_batch_op_t op);
+
+#if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+    static nvm_status_t nvm_sync_queue      (const nvm_region_name_t region, pf_nvm_sync_cb_t pf_cb);
+    static nvm_status_t nvm_sync_job_step   (void);
+    static void         nvm_sync_job_finish (void);
+    static bool         nvm_sync_is_busy    (void);
+    static void         nvm_sync_report     (void);
+#endif
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+    static bool         nvm_async_has_dma   (const nvm_mem_driver_t * const p_drv);
+    static bool         nvm_async_is_busy   (const nvm_region_name_t region);
+    static nvm_status_t nvm_async_execute   (const nvm_async_req_t * const p_req);
+    static void         nvm_async_start     (const nvm_mem_drv_name_t drv);
+    static nvm_status_t nvm_async_queue     (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data, const bool write, pf_nvm_async_cb_t pf_cb);
+    static nvm_status_t nvm_async_process   (void);
+#endif
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+    static bool         nvm_write_is_unchanged  (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+#endif
+
+#if ( 1 == NVM_CFG_CRC_EN )
+    static nvm_status_t nvm_crc_calc_drv    (const nvm_region_name_t region, uint32_t * const p_crc);
+    static nvm_status_t nvm_crc_check_drv   (const nvm_region_name_t region);
+    static nvm_status_t nvm_crc_update_drv  (const nvm_region_name_t region);
+    static nvm_status_t nvm_crc_verify_drv  (const nvm_region_name_t region);
+    static void         nvm_crc_touch_drv   (const nvm_region_name_t region);
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -95,10 +293,76 @@ static nvm_status_t nvm_check_config(void)
             status = eNVM_ERROR;
             break;
         }
+
+        // Programming unit must fit into flash page
+        if  (   ( 0U != gp_nvm_drivers[mem_drv].page_size )
+            &&  ( 0U != gp_nvm_drivers[mem_drv].prog_size )
+            &&  ( 0U != ( gp_nvm_drivers[mem_drv].page_size % gp_nvm_drivers[mem_drv].prog_size )))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        // Sync chunk must consist of whole programming units
+        if  (   ( 0U != gp_nvm_drivers[mem_drv].prog_size )
+            &&  ( 0U != ( NVM_CFG_EE_SYNC_CHUNK_SIZE % gp_nvm_drivers[mem_drv].prog_size )))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        // Asynchronous read and write must be provided together
+        if (( NULL == gp_nvm_drivers[mem_drv].pf_nvm_write_async ) != ( NULL == gp_nvm_drivers[mem_drv].pf_nvm_read_async ))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        // Write cache needs device page of non-emulated driver
+        #if ( 1 == NVM_CFG_WCACHE_EN )
+            if  (   ( true == gp_nvm_drivers[mem_drv].wcache_en )
+                &&  (   ( true == gp_nvm_drivers[mem_drv].ee_en )
+                    ||  ( 0U == gp_nvm_drivers[mem_drv].page_size )
+                    ||  ( gp_nvm_drivers[mem_drv].page_size > NVM_CFG_WCACHE_SIZE )))
+            {
+                status = eNVM_ERROR;
+                break;
+            }
+        #endif
+
+        // Read cache is for non-emulated driver only
+        #if ( 1 == NVM_CFG_RCACHE_EN )
+            if  (   ( true == gp_nvm_drivers[mem_drv].rcache_en )
+                &&  ( true == gp_nvm_drivers[mem_drv].ee_en ))
+            {
+                status = eNVM_ERROR;
+                break;
+            }
+        #endif
+
+        // Program-only sync is for in-place EEPROM emulation only
+        #if ( 1 == NVM_CFG_EE_PROG_ONLY_EN )
+            if  (   ( true == gp_nvm_drivers[mem_drv].prog_only_en )
+                &&  (   ( false == gp_nvm_drivers[mem_drv].ee_en )
+                    ||  ( NULL != gp_nvm_drivers[mem_drv].p_ee_log )))
+            {
+                status = eNVM_ERROR;
+                break;
+            }
+        #endif
+
+        // Log-structured EEPROM emulation requires flash page size
+        if  (   ( true == gp_nvm_drivers[mem_drv].ee_en )
+            &&  ( NULL != gp_nvm_drivers[mem_drv].p_ee_log )
+            &&  ( 0U == gp_nvm_drivers[mem_drv].page_size ))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
     }
     
     // Check all regions are configuraed OK
-    for ( uint32_t reg_idx = 0U; reg_idx < eNVM_REGION_NUM_OF; reg_idx++)
+    for ( uint32_t reg_idx = 0U; ( reg_idx < eNVM_REGION_NUM_OF ) && ( eNVM_OK == status ); reg_idx++)
     {
         if  (   ( NULL == gp_nvm_regions[reg_idx].name )
             ||  ( NULL == gp_nvm_regions[reg_idx].p_driver )
@@ -107,6 +371,74 @@ static nvm_status_t nvm_check_config(void)
             status = eNVM_ERROR;
             break;        
         }
+
+        // Integrity trailer needs CRC support and must leave space for data
+        if  (   ( true == gp_nvm_regions[reg_idx].crc_en )
+            &&  (   ( 1 != NVM_CFG_CRC_EN )
+                ||  ( gp_nvm_regions[reg_idx].size <= NVM_CRC_SIZE )))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        // A/B region needs in-place EEPROM emulation with known flash
+        // geometry. Slots start at page boundary and content consists
+        // of whole programming units.
+        if ( true == gp_nvm_regions[reg_idx].ab_en )
+        {
+            const nvm_mem_driver_t * const p_ab_drv = gp_nvm_regions[reg_idx].p_driver;
+
+            if  (   ( 1 != NVM_CFG_EE_AB_EN )
+                ||  ( false == p_ab_drv->ee_en )
+                ||  ( NULL != p_ab_drv->p_ee_log )
+                ||  ( 0U == p_ab_drv->page_size )
+                ||  ( 0U != ( gp_nvm_regions[reg_idx].start_addr % p_ab_drv->page_size ))
+                ||  ( p_ab_drv->prog_size > NVM_AB_FOOTER_MAX_SIZE )
+                ||  (   ( 0U != p_ab_drv->prog_size )
+                    &&  ( 0U != ( gp_nvm_regions[reg_idx].size % p_ab_drv->prog_size ))))
+            {
+                status = eNVM_ERROR;
+                break;
+            }
+        }
+
+        // Region must fit into memory device
+        if  (   ( 0U != gp_nvm_regions[reg_idx].p_driver->mem_size )
+            &&  (   ( gp_nvm_regions[reg_idx].start_addr > gp_nvm_regions[reg_idx].p_driver->mem_size )
+                ||  ( nvm_get_footprint((nvm_region_name_t) reg_idx ) > ( gp_nvm_regions[reg_idx].p_driver->mem_size - gp_nvm_regions[reg_idx].start_addr ))))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        // Regions of the same memory driver must not overlap
+        for ( uint32_t other_idx = ( reg_idx + 1U ); other_idx < eNVM_REGION_NUM_OF; other_idx++)
+        {
+            if  (   ( gp_nvm_regions[reg_idx].p_driver == gp_nvm_regions[other_idx].p_driver )
+                &&  ( gp_nvm_regions[reg_idx].start_addr < ( gp_nvm_regions[other_idx].start_addr + nvm_get_footprint((nvm_region_name_t) other_idx )))
+                &&  ( gp_nvm_regions[other_idx].start_addr < ( gp_nvm_regions[reg_idx].start_addr + nvm_get_footprint((nvm_region_name_t) reg_idx ))))
+            {
+                status = eNVM_ERROR;
+                break;
+            }
+        }
+
+        // In-place EEPROM emulated region sharing flash page needs page buffer
+        const nvm_mem_driver_t * const p_drv = gp_nvm_regions[reg_idx].p_driver;
+
+        if  (   ( NULL != p_drv )
+            &&  ( true == p_drv->ee_en )
+            &&  ( NULL == p_drv->p_ee_log )
+            &&  ( 0U != p_drv->page_size )
+            &&  ( false == gp_nvm_regions[reg_idx].ab_en ))
+        {
+            if  (   (( 0U != ( gp_nvm_regions[reg_idx].start_addr % p_drv->page_size ))
+                ||   ( 0U != ( gp_nvm_regions[reg_idx].size % p_drv->page_size )))
+                &&  ( p_drv->page_size > NVM_CFG_EE_PAGE_BUF_SIZE ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
     }
 
     return status;
@@ -114,426 +446,3140 @@ static nvm_status_t nvm_check_config(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
+*		Get memory driver of region
+*
+* @param[in]	region	- NVM region defined in config table
+* @return 	    drv     - Memory driver
 */
 ////////////////////////////////////////////////////////////////////////////////
+static nvm_mem_drv_name_t nvm_get_drv(const nvm_region_name_t region)
+{
+    return (nvm_mem_drv_name_t)( gp_nvm_regions[region].p_driver - gp_nvm_drivers );
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*@addtogroup NVM_API
-* @{ <!-- BEGIN GROUP -->
+*		Get size of region available to application
 *
-* 	Following function are part of NVM API.
+* @note     Integrity trailer (CRC) at the end of region is not accessible.
+*
+* @param[in]	region	- NVM region defined in config table
+* @return 	    size    - Size of region data in bytes
 */
 ////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_get_data_size(const nvm_region_name_t region)
+{
+    uint32_t size = gp_nvm_regions[region].size;
+
+    if ( true == gp_nvm_regions[region].crc_en )
+    {
+        size -= NVM_CRC_SIZE;
+    }
+
+    return size;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Initialized NVM regions
+*		Get size of memory occupied by region
 *
-* @return 	status - Status of initialization
+* @note     A/B region occupies two slots with footers.
+*
+* @param[in]	region	- NVM region defined in config table
+* @return 	    size    - Size of memory in bytes
 */
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_init(void)
+static uint32_t nvm_get_footprint(const nvm_region_name_t region)
 {
-	nvm_status_t status = eNVM_OK;
-
-	if ( false == gb_is_init )
-	{
-		// Get table configuration
-		gp_nvm_regions = nvm_cfg_get_regions();
-		gp_nvm_drivers = nvm_cfg_get_drivers();
-		NVM_ASSERT( NULL != gp_nvm_regions );
-		NVM_ASSERT( NULL != gp_nvm_drivers );
+    uint32_t size = gp_nvm_regions[region].size;
 
-        // Check for valid configuration
-        if ( eNVM_OK == nvm_check_config())
+    #if ( 1 == NVM_CFG_EE_AB_EN )
+        if ( true == gp_nvm_regions[region].ab_en )
         {
-    		// Low level driver init
-    		for ( uint32_t mem_drv_num = 0; mem_drv_num < eNVM_MEM_DRV_NUM_OF; mem_drv_num++ )
-    		{
-                // Init low level memory driver
-                status |= gp_nvm_drivers[mem_drv_num].pf_nvm_init();
+            size = ( 2U * nvm_ee_ab_calc_slot_size( &gp_nvm_regions[region] ));
+        }
+    #endif
 
-                NVM_DBG_PRINT( "NVM: Low level memory driver #%d initialize with status: %s", mem_drv_num, nvm_get_status_str( status ));
-    		}
+    return size;
+}
 
-            // Init NVM EEPROM Emulation
-            status |= nvm_ee_init();
+#if ( 1 == NVM_CFG_MUTEX_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Lock access to memory driver
+    *
+    * @note     With NVM_CFG_MUTEX_PER_DRV_EN only given memory driver is
+    *           locked, so other drivers can be accessed concurrently.
+    *           Otherwise global NVM mutex is taken.
+    *
+    * @param[in]	drv	    - Memory driver
+    * @return 	    status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_lock_drv(const nvm_mem_drv_name_t drv)
+    {
+        #if ( 1 == NVM_DRV_LOCK_EN )
+            return nvm_if_aquire_drv_mutex( drv );
+        #else
+            (void) drv;
+            return nvm_if_aquire_mutex();
+        #endif
+    }
 
-    		// Init NVM interface
-    		status |= nvm_if_init();
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Unlock access to memory driver
+    *
+    * @param[in]	drv	    - Memory driver
+    * @return 	    void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_unlock_drv(const nvm_mem_drv_name_t drv)
+    {
+        #if ( 1 == NVM_DRV_LOCK_EN )
+            nvm_if_release_drv_mutex( drv );
+        #else
+            (void) drv;
+            nvm_if_release_mutex();
+        #endif
+    }
 
-    		// Init success
-    		if ( eNVM_OK == status )
-    		{
-    			gb_is_init = true;
-    		}
-        }
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Lock access to region
+    *
+    * @note     Memory driver of region is locked.
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 	    status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_lock_region(const nvm_region_name_t region)
+    {
+        return nvm_lock_drv( nvm_get_drv( region ));
+    }
 
-        // Invalid NVM configuration
-        else
-        {
-            status = eNVM_ERROR;
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Unlock access to region
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 	    void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_unlock_region(const nvm_region_name_t region)
+    {
+        nvm_unlock_drv( nvm_get_drv( region ));
+    }
 
-            NVM_DBG_PRINT( "NVM: Configuration invalid!" );
-            NVM_ASSERT( 0 );
-        }
-	}
-	else
-	{
-		status = eNVM_ERROR;
-	}
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Lock access for batch operation
+    *
+    * @note     Global mutex is taken as it guards staging buffer. With
+    *           NVM_CFG_MUTEX_PER_DRV_EN all memory drivers used by batch
+    *           items are locked afterwards in ascending order.
+    *
+    * @param[in]	p_items	    - Batch items
+    * @param[in]	num	        - Number of items
+    * @param[out]	p_locked    - Bitmask of locked memory drivers
+    * @return 	    status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_lock_batch(const nvm_batch_item_t * const p_items, const uint32_t num, uint32_t * const p_locked)
+    {
+        nvm_status_t status = nvm_if_aquire_mutex();
 
-	return status;
-}
+        *p_locked = 0U;
+
+        #if ( 1 == NVM_DRV_LOCK_EN )
+            NVM_STATIC_ASSERT( eNVM_MEM_DRV_NUM_OF <= 32U, "Locked memory drivers do not fit into bitmask!" );
+
+            for ( uint32_t drv = 0U; ( drv < eNVM_MEM_DRV_NUM_OF ) && ( eNVM_OK == status ); drv++ )
+            {
+                for ( uint32_t i = 0U; i < num; i++ )
+                {
+                    if  (   ( eNVM_OK == p_items[i].status )
+                        &&  ( drv == (uint32_t) nvm_get_drv( p_items[i].region )))
+                    {
+                        status = nvm_if_aquire_drv_mutex((nvm_mem_drv_name_t) drv );
+
+                        if ( eNVM_OK == status )
+                        {
+                            *p_locked |= ( 1UL << drv );
+                        }
+
+                        // Release partially taken locks together with global mutex
+                        else
+                        {
+                            nvm_unlock_batch( *p_locked );
+                            *p_locked = 0U;
+                        }
+                        break;
+                    }
+                }
+            }
+        #else
+            (void) p_items;
+            (void) num;
+        #endif
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Unlock access after batch operation
+    *
+    * @note     Locks are released based on drivers locked by nvm_lock_batch()
+    *           and not on item status as driver call may fail afterwards.
+    *
+    * @param[in]	locked  - Bitmask of locked memory drivers
+    * @return 	    void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_unlock_batch(const uint32_t locked)
+    {
+        #if ( 1 == NVM_DRV_LOCK_EN )
+            for ( uint32_t drv = eNVM_MEM_DRV_NUM_OF; drv > 0U; drv-- )
+            {
+                if ( 0U != ( locked & ( 1UL << ( drv - 1U ))))
+                {
+                    nvm_if_release_drv_mutex((nvm_mem_drv_name_t)( drv - 1U ));
+                }
+            }
+        #else
+            (void) locked;
+        #endif
+
+        nvm_if_release_mutex();
+    }
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		De-Initialized NVM memory drivers
+*		Check batch item
 *
-*
-* @return 	status - Status of initialization
+* @param[in]	p_item	- Batch item
+* @param[in]	op	    - Batch operation
+* @return 	    status  - Status of check
 */
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_deinit(void)
+static nvm_status_t nvm_batch_check(const nvm_batch_item_t * const p_item, const nvm_batch_op_t op)
 {
     nvm_status_t status = eNVM_OK;
-    
-    if ( true == gb_is_init )
-    {
-        // Low level driver de-init
-        for ( uint32_t mem_drv_num = 0; mem_drv_num < eNVM_MEM_DRV_NUM_OF; mem_drv_num++ )
-        {
-            if ( NULL != gp_nvm_regions[mem_drv_num].p_driver->pf_nvm_deinit )
-            {
-                status |= gp_nvm_regions[mem_drv_num].p_driver->pf_nvm_deinit();
 
-                NVM_DBG_PRINT( "NVM: Low level memory driver #%d de-initialize with status: %s", mem_drv_num, nvm_get_status_str( status ));
-            }
-        } 
-
-        // De-init success
-        if ( eNVM_OK == status )
-        {
-            gb_is_init = false;
-        }
+    if  (   ( p_item->region >= eNVM_REGION_NUM_OF )
+        ||  (( NULL == p_item->p_data ) && ( eNVM_BATCH_ERASE != op )))
+    {
+        status = eNVM_ERROR;
     }
-    else
+    else if (   ( p_item->size > nvm_get_data_size( p_item->region ))
+            ||  ( p_item->addr > ( nvm_get_data_size( p_item->region ) - p_item->size )))
     {
         status = eNVM_ERROR;
     }
+    else
+    {
+        // Valid item
+    }
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get NVM initialization state
+*		Check if memory driver provides vectored function for batch operation
 *
-* @param[out]   p_is_init   - Pointer to init flag
-* @return       status      - Status of operation
+* @param[in]	p_drv	- Memory driver
+* @param[in]	op	    - Batch operation
+* @return 	    has_v   - Vectored function provided
 */
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_is_init(bool * const p_is_init)
+static bool nvm_batch_has_v(const nvm_mem_driver_t * const p_drv, const nvm_batch_op_t op)
 {
-    nvm_status_t status = eNVM_OK;
+    bool has_v = false;
 
-    if ( NULL != p_is_init )
+    if ( eNVM_BATCH_WRITE == op )
     {
-        *p_is_init = gb_is_init;
+        has_v = ( NULL != p_drv->pf_nvm_write_v );
+    }
+    else if ( eNVM_BATCH_READ == op )
+    {
+        has_v = ( NULL != p_drv->pf_nvm_read_v );
     }
     else
     {
-        status = eNVM_ERROR;
+        has_v = ( NULL != p_drv->pf_nvm_erase_v );
     }
 
-    return status;
+    return has_v;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Write data to NVM region
+*		Find run of batch items that can be transfered with single driver call
 *
-* @note		Input address argument of write function in NVM region is
-* 			offset by defined start address of region!
+* @brief    Consecutive items of the same non-emulated memory driver are
+*           coalesced. If driver provides vectored function, up to
+*           NVM_BATCH_VEC_MAX items are transfered with single vectored
+*           call. Otherwise items must address adjacent memory. Items with
+*           adjacent data buffers are transfered directly, others via
+*           staging buffer of NVM_CFG_BATCH_BUF_SIZE bytes.
 *
-* @param[in]	region	- NVM region defined in config table
-* @param[in]	addr	- Start region address + address
-* @param[in]	size	- Size of written data in bytes
-* @param[in]	p_data	- Pointer to written data
-* @return 		status	- Status of operation
+* @param[in]	p_items	- Batch items
+* @param[in]	num	    - Number of items
+* @param[in]	first	- First item of run
+* @param[in]	op	    - Batch operation
+* @return 	    last    - Last item of run
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_batch_get_run(const nvm_batch_item_t * const p_items, const uint32_t num, const uint32_t first, const nvm_batch_op_t op)
+{
+    const nvm_mem_driver_t * const  p_drv       = gp_nvm_regions[ p_items[first].region ].p_driver;
+    const bool                      vectored    = nvm_batch_has_v( p_drv, op );
+    uint32_t                        last        = first;
+    uint32_t                        run_size    = p_items[first].size;
+    bool                            adjacent    = true;
+    bool                            next_adj    = false;
+
+    if ( false == p_drv->ee_en )
+    {
+        while ( ( last + 1U ) < num )
+        {
+            const nvm_batch_item_t * const p_prev = &p_items[last];
+            const nvm_batch_item_t * const p_next = &p_items[last + 1U];
+
+            // Same driver
+            if  (   ( eNVM_OK != p_next->status )
+                ||  ( p_drv != gp_nvm_regions[p_next->region].p_driver ))
+            {
+                break;
+            }
+
+            // Any range with vectored driver function
+            if ( true == vectored )
+            {
+                if ((( last + 1U ) - first ) >= NVM_BATCH_VEC_MAX )
+                {
+                    break;
+                }
+            }
+
+            // Adjacent memory only
+            else
+            {
+                if (( gp_nvm_regions[p_prev->region].start_addr + p_prev->addr + p_prev->size ) != ( gp_nvm_regions[p_next->region].start_addr + p_next->addr ))
+                {
+                    break;
+                }
+
+                // Transfer directly or via staging buffer
+                if ( eNVM_BATCH_ERASE != op )
+                {
+                    next_adj = (( true == adjacent ) && (( p_prev->p_data + p_prev->size ) == p_next->p_data ));
+
+                    if  (   ( false == next_adj )
+                        &&  (( run_size + p_next->size ) > NVM_CFG_BATCH_BUF_SIZE ))
+                    {
+                        break;
+                    }
+
+                    adjacent = next_adj;
+                }
+            }
+
+            run_size += p_next->size;
+            last++;
+        }
+    }
+
+    return last;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute batch item of EEPROM emulated region
+*
+* @param[in]	p_item	- Batch item
+* @param[in]	op	    - Batch operation
+* @return 	    status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_batch_run_ee(const nvm_batch_item_t * const p_item, const nvm_batch_op_t op)
+{
+    nvm_status_t status = eNVM_OK;
+
+    if ( eNVM_BATCH_WRITE == op )
+    {
+        status = nvm_ee_write( p_item->region, p_item->addr, p_item->size, p_item->p_data );
+    }
+    else if ( eNVM_BATCH_READ == op )
+    {
+        status = nvm_ee_read( p_item->region, p_item->addr, p_item->size, p_item->p_data );
+    }
+    else
+    {
+        status = nvm_ee_erase( p_item->region, p_item->addr, p_item->size );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute run of batch items with vectored driver function
+*
+* @param[in]	p_items	- Batch items
+* @param[in]	first	- First item of run
+* @param[in]	last	- Last item of run
+* @param[in]	op	    - Batch operation
+* @return 	    status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_batch_run_v(const nvm_batch_item_t * const p_items, const uint32_t first, const uint32_t last, const nvm_batch_op_t op)
+{
+    nvm_status_t                    status                  = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv                   = gp_nvm_regions[ p_items[first].region ].p_driver;
+    nvm_vec_t                       vec[NVM_BATCH_VEC_MAX]  = { 0 };
+    uint32_t                        num                     = 0U;
+
+    for ( uint32_t i = first; i <= last; i++ )
+    {
+        vec[num].addr   = ( gp_nvm_regions[ p_items[i].region ].start_addr + p_items[i].addr );
+        vec[num].size   = p_items[i].size;
+        vec[num].p_data = p_items[i].p_data;
+        num++;
+    }
+
+    if ( eNVM_BATCH_WRITE == op )
+    {
+        status = nvm_drv_write_v( p_drv, (const nvm_vec_t*) &vec, num );
+    }
+    else if ( eNVM_BATCH_READ == op )
+    {
+        status = nvm_drv_read_v( p_drv, (const nvm_vec_t*) &vec, num );
+    }
+    else
+    {
+        status = nvm_drv_erase_v( p_drv, (const nvm_vec_t*) &vec, num );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute run of batch items with adjacent memory
+*
+* @param[in]	p_items	- Batch items
+* @param[in]	first	- First item of run
+* @param[in]	last	- Last item of run
+* @param[in]	op	    - Batch operation
+* @return 	    status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_batch_run_adjacent(const nvm_batch_item_t * const p_items, const uint32_t first, const uint32_t last, const nvm_batch_op_t op)
+{
+    nvm_status_t                    status      = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv       = gp_nvm_regions[ p_items[first].region ].p_driver;
+    const uint32_t                  addr        = ( gp_nvm_regions[ p_items[first].region ].start_addr + p_items[first].addr );
+    uint32_t                        run_size    = 0U;
+    bool                            adjacent    = true;
+
+    for ( uint32_t i = first; i <= last; i++ )
+    {
+        if (( i > first ) && (( p_items[i - 1U].p_data + p_items[i - 1U].size ) != p_items[i].p_data ))
+        {
+            adjacent = false;
+        }
+
+        run_size += p_items[i].size;
+    }
+
+    // Erase does not need data
+    if ( eNVM_BATCH_ERASE == op )
+    {
+        status = NVM_DEV_ERASE( p_drv, addr, run_size );
+    }
+
+    // Single driver call directly from/to item buffers
+    else if ( true == adjacent )
+    {
+        if ( eNVM_BATCH_WRITE == op )
+        {
+            status = NVM_DEV_WRITE( p_drv, addr, run_size, p_items[first].p_data );
+        }
+        else
+        {
+            status = NVM_DEV_READ( p_drv, addr, run_size, p_items[first].p_data );
+        }
+    }
+
+    // Single driver call via staging buffer
+    else
+    {
+        #if ( NVM_CFG_BATCH_BUF_SIZE > 0 )
+            uint32_t offset = 0U;
+
+            if ( eNVM_BATCH_WRITE == op )
+            {
+                for ( uint32_t i = first; i <= last; i++ )
+                {
+                    memcpy( &g_batch_buf[offset], p_items[i].p_data, p_items[i].size );
+                    offset += p_items[i].size;
+                }
+
+                status = NVM_DEV_WRITE( p_drv, addr, run_size, (const uint8_t*) &g_batch_buf );
+            }
+            else
+            {
+                status = NVM_DEV_READ( p_drv, addr, run_size, (uint8_t*) &g_batch_buf );
+
+                for ( uint32_t i = first; ( i <= last ) && ( eNVM_OK == status ); i++ )
+                {
+                    memcpy( p_items[i].p_data, &g_batch_buf[offset], p_items[i].size );
+                    offset += p_items[i].size;
+                }
+            }
+        #else
+            status = eNVM_ERROR;
+        #endif
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute run of batch items
+*
+* @param[in]	p_items	- Batch items
+* @param[in]	first	- First item of run
+* @param[in]	last	- Last item of run
+* @param[in]	op	    - Batch operation
+* @return 	    status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_batch_run(nvm_batch_item_t * const p_items, const uint32_t first, const uint32_t last, const nvm_batch_op_t op)
+{
+    nvm_status_t                    status  = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv   = gp_nvm_regions[ p_items[first].region ].p_driver;
+
+    // Driver calls of whole run are accounted to region of first item
+    #if ( 1 == NVM_CFG_STATS_EN )
+        static const nvm_stats_op_t stats_op[] =
+        {
+            [eNVM_BATCH_WRITE]  = eNVM_STATS_OP_WRITE,
+            [eNVM_BATCH_READ]   = eNVM_STATS_OP_READ,
+            [eNVM_BATCH_ERASE]  = eNVM_STATS_OP_ERASE,
+        };
+        const uint32_t ts = nvm_if_get_timestamp();
+
+        nvm_stats_attach( p_items[first].region );
+    #endif
+
+    // Direct modification makes integrity trailer stale
+    #if ( 1 == NVM_CFG_CRC_EN )
+        if ( eNVM_BATCH_READ != op )
+        {
+            for ( uint32_t i = first; i <= last; i++ )
+            {
+                nvm_crc_touch_drv( p_items[i].region );
+            }
+        }
+    #endif
+
+    // EEPROM emulated region
+    if ( true == p_drv->ee_en )
+    {
+        status = nvm_batch_run_ee( &p_items[first], op );
+    }
+
+    // Asynchronous transfer in flight
+    #if ( 1 == NVM_CFG_ASYNC_EN )
+        else if ( true == nvm_async_is_busy( p_items[first].region ))
+        {
+            status = eNVM_ERROR;
+        }
+    #endif
+
+    // Cached writes must reach device before direct access
+    #if ( 1 == NVM_CFG_WCACHE_EN )
+        else if ( eNVM_OK != nvm_wcache_flush( nvm_get_drv( p_items[first].region )))
+        {
+            status = eNVM_ERROR;
+        }
+    #endif
+
+    // Multiple ranges with vectored driver function
+    else if (( last > first ) && ( true == nvm_batch_has_v( p_drv, op )))
+    {
+        status = nvm_batch_run_v( p_items, first, last, op );
+    }
+
+    // Single range
+    else
+    {
+        status = nvm_batch_run_adjacent( p_items, first, last, op );
+    }
+
+    // Normalize driver status
+    if ( eNVM_OK != status )
+    {
+        status = eNVM_ERROR;
+    }
+
+    // Read cache does not see direct access
+    #if ( 1 == NVM_CFG_RCACHE_EN )
+        if  (   ( false == p_drv->ee_en )
+            &&  ( eNVM_BATCH_READ != op ))
+        {
+            for ( uint32_t i = first; i <= last; i++ )
+            {
+                nvm_rcache_invalidate( nvm_get_drv( p_items[i].region ), gp_nvm_regions[ p_items[i].region ].start_addr + p_items[i].addr, p_items[i].size );
+            }
+        }
+    #endif
+
+    for ( uint32_t i = first; i <= last; i++ )
+    {
+        p_items[i].status = status;
+
+        #if ( 1 == NVM_CFG_STATS_EN )
+            nvm_stats_add_op( p_items[i].region, stats_op[op], p_items[i].size, ts );
+        #endif
+    }
+
+    #if ( 1 == NVM_CFG_STATS_EN )
+        nvm_stats_detach( p_items[first].region );
+    #endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute batch operation
+*
+* @brief    All items are checked up front, invalid items are skipped. Then
+*           lock is taken once and valid items are executed in given order
+*           with the fewest driver calls.
+*
+* @param[in]	p_items	- Batch items
+* @param[in]	num	    - Number of items
+* @param[in]	op	    - Batch operation
+* @return 	    status  - Status of operation. Error if any item failed.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_batch_execute(nvm_batch_item_t * const p_items, const uint32_t num, const nvm_batch_op_t op)
+{
+    nvm_status_t    status  = eNVM_OK;
+    uint32_t        last    = 0U;
+
+    #if ( 1 == NVM_CFG_MUTEX_EN )
+        uint32_t    locked  = 0U;
+    #endif
+
+    // Validate all items first
+    for ( uint32_t i = 0U; i < num; i++ )
+    {
+        p_items[i].status = nvm_batch_check( &p_items[i], op );
+        status |= p_items[i].status;
+    }
+
+    #if ( 1 == NVM_CFG_MUTEX_EN )
+        if ( eNVM_OK == nvm_lock_batch( p_items, num, &locked ))
+        {
+    #endif
+
+    for ( uint32_t first = 0U; first < num; first = ( last + 1U ))
+    {
+        last = first;
+
+        if ( eNVM_OK == p_items[first].status )
+        {
+            last = nvm_batch_get_run( p_items, num, first, op );
+            status |= nvm_batch_run( p_items, first, last, op );
+        }
+    }
+
+    #if ( 1 == NVM_CFG_MUTEX_EN )
+            nvm_unlock_batch( locked );
+        }
+
+        // Mutex not acquire
+        else
+        {
+            status = eNVM_ERROR;
+
+            for ( uint32_t i = 0U; i < num; i++ )
+            {
+                p_items[i].status = eNVM_ERROR;
+            }
+        }
+    #endif
+
+    return status;
+}
+
+#if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Queue sync request of NVM region
+    *
+    * @note     Request for region that is already pending is merged with
+    *           pending one. Completion callback is replaced.
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[in]	pf_cb	- Completion callback. Can be NULL.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_sync_queue(const nvm_region_name_t region, pf_nvm_sync_cb_t pf_cb)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+            if ( eNVM_OK == nvm_if_aquire_mutex())
+            {
+        #endif
+
+        #if ( 1 == NVM_CFG_STATS_EN )
+            if ( false == g_sync_req[region].pending )
+            {
+                g_sync_req[region].ts = nvm_if_get_timestamp();
+            }
+        #endif
+
+        g_sync_req[region].pf_cb    = pf_cb;
+        g_sync_req[region].pending  = true;
+
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+                nvm_if_release_mutex();
+            }
+
+            // Mutex not acquire
+            else
+            {
+                status = eNVM_ERROR;
+            }
+        #endif
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Execute single step of asynchronous sync
+    *
+    * @brief    Continues sync in progress or starts next queued request.
+    *           Requests are served in round-robin order.
+    *
+    * @note     Caller must hold NVM mutex! Memory driver lock of synced
+    *           region is taken by this function (lock order: NVM mutex,
+    *           then memory driver).
+    *
+    * @return 	status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_sync_job_step(void)
+    {
+        nvm_status_t        status  = eNVM_OK;
+        bool                pending = false;
+        bool                start   = false;
+        nvm_region_name_t   region  = g_sync_region;
+
+        // Start next queued request
+        if ( false == gb_sync_active )
+        {
+            for ( uint32_t i = 1U; i <= eNVM_REGION_NUM_OF; i++ )
+            {
+                region = (nvm_region_name_t)(( g_sync_region + i ) % eNVM_REGION_NUM_OF );
+
+                if ( true == g_sync_req[region].pending )
+                {
+                    g_sync_region   = region;
+                    gb_sync_active  = true;
+                    start           = true;
+                    break;
+                }
+            }
+        }
+
+        if ( true == gb_sync_active )
+        {
+            // Region data are guarded by its memory driver lock
+            #if ( 1 == NVM_DRV_LOCK_EN )
+                if ( eNVM_OK == nvm_if_aquire_drv_mutex( nvm_get_drv( g_sync_region )))
+                {
+            #endif
+
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_attach( g_sync_region );
+            #endif
+
+            if ( true == start )
+            {
+                status = nvm_ee_sync_start( g_sync_region );
+
+                #if ( 1 == NVM_CFG_CRC_EN )
+                    status |= nvm_crc_update_drv( g_sync_region );
+                #endif
+            }
+
+            if ( eNVM_OK == status )
+            {
+                status = nvm_ee_sync_step( &pending );
+            }
+
+            // Data and trailer must reach device before completion is reported
+            #if ( 1 == NVM_CFG_WCACHE_EN )
+                if  (   ( eNVM_OK != status )
+                    ||  ( false == pending ))
+                {
+                    status |= nvm_wcache_flush( nvm_get_drv( g_sync_region ));
+                }
+            #endif
+
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_detach( g_sync_region );
+
+                if  (   ( eNVM_OK != status )
+                    ||  ( false == pending ))
+                {
+                    nvm_stats_add_op( g_sync_region, eNVM_STATS_OP_SYNC, 0U, g_sync_req[g_sync_region].ts );
+                }
+            #endif
+
+            #if ( 1 == NVM_DRV_LOCK_EN )
+                    nvm_if_release_drv_mutex( nvm_get_drv( g_sync_region ));
+                }
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+
+            // Sync completed
+            if  (   ( eNVM_OK != status )
+                ||  ( false == pending ))
+            {
+                g_sync_req[g_sync_region].status    = status;
+                g_sync_req[g_sync_region].pending   = false;
+                g_sync_req[g_sync_region].done      = true;
+                gb_sync_active = false;
+
+                NVM_TRACE( eNVM_TRACE_SYNC_DONE, g_sync_region, 0U, 0U, status );
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Complete asynchronous sync in progress
+    *
+    * @note     Caller must hold NVM mutex!
+    *
+    * @return 	void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_sync_job_finish(void)
+    {
+        while ( true == gb_sync_active )
+        {
+            (void) nvm_sync_job_step();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check if any sync request is queued or in progress
+    *
+    * @note     Caller must hold NVM mutex!
+    *
+    * @return 	busy - Sync work remains
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_sync_is_busy(void)
+    {
+        bool busy = gb_sync_active;
+
+        for ( uint32_t region = 0U; ( region < eNVM_REGION_NUM_OF ) && ( false == busy ); region++ )
+        {
+            busy = g_sync_req[region].pending;
+        }
+
+        return busy;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Report completed asynchronous syncs
+    *
+    * @note     Callbacks are called without holding NVM mutex, therefore
+    *           NVM API can be used inside callback.
+    *
+    * @return 	void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_sync_report(void)
+    {
+        pf_nvm_sync_cb_t    pf_cb   = NULL;
+        nvm_status_t        status  = eNVM_OK;
+        bool                done    = false;
+
+        for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+        {
+            done = false;
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_if_aquire_mutex())
+                {
+            #endif
+
+            if ( true == g_sync_req[region].done )
+            {
+                pf_cb   = g_sync_req[region].pf_cb;
+                status  = g_sync_req[region].status;
+                done    = true;
+
+                g_sync_req[region].done = false;
+            }
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_if_release_mutex();
+                }
+            #endif
+
+            if  (   ( true == done )
+                &&  ( NULL != pf_cb ))
+            {
+                pf_cb((nvm_region_name_t) region, status );
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check if memory driver transfers asynchronously
+    *
+    * @note     EEPROM emulated regions are served from RAM, therefore
+    *           asynchronous functions of EEPROM emulated driver are not used.
+    *
+    * @param[in]	p_drv	- Memory driver
+    * @return 	    has_dma - Driver provides asynchronous read and write
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_async_has_dma(const nvm_mem_driver_t * const p_drv)
+    {
+        return (( false == p_drv->ee_en ) && ( NULL != p_drv->pf_nvm_write_async ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check if asynchronous transfer of region memory driver is in flight
+    *
+    * @note     Caller must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 	    busy    - Asynchronous transfer queued or in progress
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_async_is_busy(const nvm_region_name_t region)
+    {
+        const nvm_async_queue_t * const p_queue = &g_async_queue[ nvm_get_drv( region ) ];
+        bool                            busy    = false;
+
+        // Requests complete in order, so check the newest one
+        if ( p_queue->num > 0U )
+        {
+            busy = ( false == p_queue->req[ ( p_queue->head + p_queue->num - 1U ) % NVM_CFG_ASYNC_QUEUE_SIZE ].done );
+        }
+
+        return busy;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Execute asynchronous request synchronously
+    *
+    * @note     Used for EEPROM emulated regions and for memory drivers
+    *           without asynchronous functions. Caller must hold lock of region!
+    *
+    * @param[in]	p_req	- Request
+    * @return 	    status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_async_execute(const nvm_async_req_t * const p_req)
+    {
+        nvm_status_t                    status  = eNVM_OK;
+        const nvm_region_t * const      p_reg   = &gp_nvm_regions[p_req->region];
+
+        if ( true == p_reg->p_driver->ee_en )
+        {
+            if ( true == p_req->write )
+            {
+                status = nvm_ee_write( p_req->region, p_req->addr, p_req->size, p_req->p_data );
+            }
+            else
+            {
+                status = nvm_ee_read( p_req->region, p_req->addr, p_req->size, p_req->p_data );
+            }
+        }
+        else
+        {
+            if ( true == p_req->write )
+            {
+                status = nvm_drv_write( nvm_get_drv( p_req->region ), p_reg->start_addr + p_req->addr, p_req->size, p_req->p_data );
+            }
+            else
+            {
+                status = nvm_drv_read( nvm_get_drv( p_req->region ), p_reg->start_addr + p_req->addr, p_req->size, p_req->p_data );
+            }
+        }
+
+        // Normalize driver status
+        if ( eNVM_OK != status )
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Start transfer of oldest queued request
+    *
+    * @note     Busy flag is set before transfer is started, as driver might
+    *           report completion already from within start function.
+    *           Caller must hold lock of memory driver!
+    *
+    * @param[in]	drv	- Memory driver
+    * @return 	    void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_async_start(const nvm_mem_drv_name_t drv)
+    {
+        nvm_async_queue_t * const       p_queue = &g_async_queue[drv];
+        nvm_async_req_t * const         p_req   = &p_queue->req[p_queue->head];
+        const nvm_mem_driver_t * const  p_drv   = &gp_nvm_drivers[drv];
+        nvm_status_t                    status  = eNVM_OK;
+
+        if  (   ( false == p_queue->busy )
+            &&  ( p_queue->num > 0U )
+            &&  ( false == p_req->done ))
+        {
+            const uint32_t addr = ( gp_nvm_regions[p_req->region].start_addr + p_req->addr );
+
+            p_queue->busy = true;
+
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_attach( p_req->region );
+            #endif
+
+            if ( true == p_req->write )
+            {
+                status = NVM_DEV_WRITE_ASYNC( p_drv, addr, p_req->size, p_req->p_data );
+            }
+            else
+            {
+                status = NVM_DEV_READ_ASYNC( p_drv, addr, p_req->size, p_req->p_data );
+            }
+
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_detach( p_req->region );
+            #endif
+
+            // Transfer not started
+            if ( eNVM_OK != status )
+            {
+                p_req->status   = eNVM_ERROR;
+                p_req->done     = true;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Queue asynchronous request
+    *
+    * @brief    Request to memory driver with asynchronous functions is started
+    *           at once if driver is idle, otherwise after completion of
+    *           requests queued before. Other requests are executed at once.
+    *           In both cases completion is reported by nvm_process().
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[in]	addr	- Start address inside region
+    * @param[in]	size	- Size in bytes
+    * @param[in]	p_data	- Data buffer. Must be valid until completion.
+    * @param[in]	write	- Write or read request
+    * @param[in]	pf_cb	- Completion callback. Can be NULL.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_async_queue(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data, const bool write, pf_nvm_async_cb_t pf_cb)
+    {
+        nvm_status_t                status  = eNVM_OK;
+        const nvm_mem_drv_name_t    drv     = nvm_get_drv( region );
+        nvm_async_queue_t * const   p_queue = &g_async_queue[drv];
+        const bool                  dma     = nvm_async_has_dma( &gp_nvm_drivers[drv] );
+
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+            if ( eNVM_OK == nvm_lock_drv( drv ))
+            {
+        #endif
+
+        // Caches do not see DMA transfer
+        if ( true == dma )
+        {
+            #if ( 1 == NVM_CFG_WCACHE_EN )
+                status = nvm_wcache_flush( drv );
+            #endif
+
+            #if ( 1 == NVM_CFG_RCACHE_EN )
+                if ( true == write )
+                {
+                    nvm_rcache_invalidate( drv, gp_nvm_regions[region].start_addr + addr, size );
+                }
+            #endif
+        }
+
+        if  (   ( eNVM_OK == status )
+            &&  ( p_queue->num < NVM_CFG_ASYNC_QUEUE_SIZE ))
+        {
+            // Integrity check must not interleave with transfer in flight,
+            // region is then only marked as modified
+            #if ( 1 == NVM_CFG_CRC_EN )
+                if  (   ( true == write )
+                    &&  ( false == p_queue->busy ))
+                {
+                    nvm_crc_touch_drv( region );
+                }
+                else if ( true == write )
+                {
+                    g_crc_drv[region].stale = true;
+                }
+                else
+                {
+                    // Read has no effect on trailer
+                }
+            #endif
+
+            nvm_async_req_t * const p_req = &p_queue->req[ ( p_queue->head + p_queue->num ) % NVM_CFG_ASYNC_QUEUE_SIZE ];
+
+            p_req->pf_cb    = pf_cb;
+            p_req->p_data   = p_data;
+            p_req->region   = region;
+            p_req->addr     = addr;
+            p_req->size     = size;
+            p_req->write    = write;
+            p_req->status   = eNVM_OK;
+            p_req->done     = false;
+            p_queue->num++;
+
+            #if ( 1 == NVM_CFG_STATS_EN )
+                const uint32_t ts = nvm_if_get_timestamp();
+            #endif
+
+            if ( true == dma )
+            {
+                nvm_async_start( drv );
+            }
+            else
+            {
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    nvm_stats_attach( region );
+                #endif
+
+                p_req->status   = nvm_async_execute( p_req );
+                p_req->done     = true;
+
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    nvm_stats_detach( region );
+                #endif
+            }
+
+            // Only start of DMA transfer is timed
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_add_op( region, (( true == write ) ? eNVM_STATS_OP_WRITE : eNVM_STATS_OP_READ ), size, ts );
+            #endif
+        }
+
+        // Queue full or flush failed
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+                nvm_unlock_drv( drv );
+            }
+
+            // Mutex not acquire
+            else
+            {
+                status = eNVM_ERROR;
+            }
+        #endif
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Report completed asynchronous requests and start next transfers
+    *
+    * @note     Callbacks are called without holding any lock, therefore
+    *           NVM API can be used inside callback.
+    *
+    * @return 	status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_async_process(void)
+    {
+        nvm_status_t    status                              = eNVM_OK;
+        nvm_async_req_t done[NVM_CFG_ASYNC_QUEUE_SIZE]      = { 0 };
+        uint32_t        done_num                            = 0U;
+
+        for ( uint32_t drv = 0U; drv < eNVM_MEM_DRV_NUM_OF; drv++ )
+        {
+            nvm_async_queue_t * const p_queue = &g_async_queue[drv];
+
+            done_num = 0U;
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_lock_drv((nvm_mem_drv_name_t) drv ))
+                {
+            #endif
+
+            // Pop completed requests
+            while   (   ( p_queue->num > 0U )
+                    &&  ( true == p_queue->req[p_queue->head].done ))
+            {
+                done[done_num].pf_cb    = p_queue->req[p_queue->head].pf_cb;
+                done[done_num].region   = p_queue->req[p_queue->head].region;
+                done[done_num].addr     = p_queue->req[p_queue->head].addr;
+                done[done_num].size     = p_queue->req[p_queue->head].size;
+                done[done_num].status   = p_queue->req[p_queue->head].status;
+                done_num++;
+
+                p_queue->head   = (( p_queue->head + 1U ) % NVM_CFG_ASYNC_QUEUE_SIZE );
+                p_queue->num--;
+                p_queue->busy   = false;
+            }
+
+            // Start next transfer
+            if ( true == nvm_async_has_dma( &gp_nvm_drivers[drv] ))
+            {
+                nvm_async_start((nvm_mem_drv_name_t) drv );
+            }
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_unlock_drv((nvm_mem_drv_name_t) drv );
+                }
+
+                // Mutex not acquire
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+
+            for ( uint32_t i = 0U; i < done_num; i++ )
+            {
+                NVM_TRACE( eNVM_TRACE_ASYNC_DONE, done[i].region, done[i].addr, done[i].size, done[i].status );
+
+                if ( NULL != done[i].pf_cb )
+                {
+                    done[i].pf_cb( done[i].region, done[i].addr, done[i].status );
+                }
+            }
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check if write would leave region content unchanged
+    *
+    * @note     EEPROM emulated regions are compared with RAM, others are
+    *           read back from memory driver (through read cache, if enabled).
+    *           On any error write is treated as changed.
+    *
+    *           Caller must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[in]	addr	- Start region address + address
+    * @param[in]	size	- Size of written data in bytes
+    * @param[in]	p_data	- Pointer to written data
+    * @return 	    unchanged   - Data already stored
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_write_is_unchanged(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+    {
+        bool unchanged = false;
+
+        // EEPROM emulated region
+        if ( true == gp_nvm_regions[region].p_driver->ee_en )
+        {
+            (void) nvm_ee_compare( region, addr, size, p_data, &unchanged );
+        }
+
+        // Device is busy with asynchronous transfer
+        #if ( 1 == NVM_CFG_ASYNC_EN )
+            else if ( true == nvm_async_is_busy( region ))
+            {
+                unchanged = false;
+            }
+        #endif
+
+        // Read back
+        else
+        {
+            (void) nvm_drv_compare( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + addr, size, p_data, &unchanged );
+        }
+
+        return unchanged;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_CRC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Calculate CRC of non-emulated region data
+    *
+    * @note     Data is read from memory driver (through caches) in chunks of
+    *           NVM_CRC_BUF_SIZE bytes. Caller must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[out]	p_crc	- CRC of region data
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_crc_calc_drv(const nvm_region_name_t region, uint32_t * const p_crc)
+    {
+        nvm_status_t    status                  = eNVM_OK;
+        uint8_t         buf[NVM_CRC_BUF_SIZE]   = { 0 };
+        const uint32_t  size                    = nvm_get_data_size( region );
+        uint32_t        chunk                   = 0U;
+        uint32_t        block_crc               = 0U;
+        uint32_t        block_left              = NVM_CFG_CRC_BLOCK_SIZE;
+
+        *p_crc = 0U;
+
+        for ( uint32_t addr = 0U; ( eNVM_OK == status ) && ( addr < size ); addr += chunk )
+        {
+            chunk = (( size - addr ) < NVM_CRC_BUF_SIZE ) ? ( size - addr ) : NVM_CRC_BUF_SIZE;
+
+            // Chunk must not cross CRC block
+            if ( chunk > block_left )
+            {
+                chunk = block_left;
+            }
+
+            status = nvm_drv_read( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + addr, chunk, (uint8_t*) &buf );
+
+            block_crc   = nvm_crc32( block_crc, (const uint8_t*) &buf, chunk );
+            block_left -= chunk;
+
+            // Block complete
+            if  (   ( 0U == block_left )
+                ||  (( addr + chunk ) >= size ))
+            {
+                *p_crc      = nvm_crc_add_block( *p_crc, block_crc );
+                block_crc   = 0U;
+                block_left  = NVM_CFG_CRC_BLOCK_SIZE;
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check integrity of non-emulated region
+    *
+    * @note     Caller must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		status	- Status of operation, eNVM_ERROR_CRC on mismatch
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_crc_check_drv(const nvm_region_name_t region)
+    {
+        nvm_status_t    status                  = eNVM_OK;
+        uint8_t         trailer[NVM_CRC_SIZE]   = { 0 };
+        uint32_t        crc                     = 0U;
+
+        status = nvm_crc_calc_drv( region, &crc );
+        status |= nvm_drv_read( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + nvm_get_data_size( region ), NVM_CRC_SIZE, (uint8_t*) &trailer );
+
+        if  (   ( eNVM_OK == status )
+            &&  ( crc != nvm_crc_get( (const uint8_t*) &trailer )))
+        {
+            status = eNVM_ERROR_CRC;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Update integrity trailer of non-emulated region
+    *
+    * @note     Trailer is written only if region was modified since last
+    *           update and CRC changed, content of untouched region is never
+    *           sealed. Has no effect on EEPROM emulated region, its trailer
+    *           is updated by sync. Caller must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_crc_update_drv(const nvm_region_name_t region)
+    {
+        nvm_status_t    status                  = eNVM_OK;
+        uint8_t         trailer[NVM_CRC_SIZE]   = { 0 };
+        uint8_t         stored[NVM_CRC_SIZE]    = { 0 };
+        uint32_t        crc                     = 0U;
+
+        if  (   ( true == gp_nvm_regions[region].crc_en )
+            &&  ( false == gp_nvm_regions[region].p_driver->ee_en )
+            &&  ( true == g_crc_drv[region].stale ))
+        {
+            status = nvm_crc_calc_drv( region, &crc );
+            status |= nvm_drv_read( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + nvm_get_data_size( region ), NVM_CRC_SIZE, (uint8_t*) &stored );
+
+            if ( eNVM_OK == status )
+            {
+                nvm_crc_set( crc, (uint8_t*) &trailer );
+
+                if ( 0 != memcmp( &trailer, &stored, NVM_CRC_SIZE ))
+                {
+                    status = nvm_drv_write( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + nvm_get_data_size( region ), NVM_CRC_SIZE, (const uint8_t*) &trailer );
+                }
+            }
+
+            // Trailer seals current content
+            if ( eNVM_OK == status )
+            {
+                g_crc_drv[region].checked   = true;
+                g_crc_drv[region].ok        = true;
+                g_crc_drv[region].stale     = false;
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Verify integrity of non-emulated region
+    *
+    * @note     Complete region is checked only at first access, afterwards
+    *           kept result is returned. Content of region modified since
+    *           last sync is trusted. Caller must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		status	- Status of operation, eNVM_ERROR_CRC on mismatch
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_crc_verify_drv(const nvm_region_name_t region)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        if  (   ( true == gp_nvm_regions[region].crc_en )
+            &&  ( false == gp_nvm_regions[region].p_driver->ee_en ))
+        {
+            if  (   ( false == g_crc_drv[region].checked )
+                &&  ( false == g_crc_drv[region].stale ))
+            {
+                status = nvm_crc_check_drv( region );
+
+                // Driver failure leaves integrity unknown
+                if (( eNVM_OK == status ) || ( eNVM_ERROR_CRC == status ))
+                {
+                    g_crc_drv[region].checked   = true;
+                    g_crc_drv[region].ok        = ( eNVM_OK == status );
+                }
+            }
+            else if (( true == g_crc_drv[region].checked ) && ( false == g_crc_drv[region].ok ))
+            {
+                status = eNVM_ERROR_CRC;
+            }
+            else
+            {
+                // Checked OK or modified since
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Prepare non-emulated region for modification
+    *
+    * @note     Integrity is checked before first modification as trailer
+    *           does not match content afterwards until next sync. Caller
+    *           must hold lock of region!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_crc_touch_drv(const nvm_region_name_t region)
+    {
+        if  (   ( true == gp_nvm_regions[region].crc_en )
+            &&  ( false == gp_nvm_regions[region].p_driver->ee_en ))
+        {
+            (void) nvm_crc_verify_drv( region );
+
+            g_crc_drv[region].stale = true;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialized NVM regions
+*
+* @return 	status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_init(void)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if ( false == gb_is_init )
+	{
+		// Get table configuration
+		gp_nvm_regions = nvm_cfg_get_regions();
+		gp_nvm_drivers = nvm_cfg_get_drivers();
+		NVM_ASSERT( NULL != gp_nvm_regions );
+		NVM_ASSERT( NULL != gp_nvm_drivers );
+
+        // Check for valid configuration
+        if ( eNVM_OK == nvm_check_config())
+        {
+    		// Low level driver init
+    		for ( uint32_t mem_drv_num = 0; mem_drv_num < eNVM_MEM_DRV_NUM_OF; mem_drv_num++ )
+    		{
+                // Init low level memory driver
+                status |= gp_nvm_drivers[mem_drv_num].pf_nvm_init();
+
+                NVM_DBG_PRINT( "NVM: Low level memory driver #%d initialize with status: %s", mem_drv_num, nvm_get_status_str( status ));
+    		}
+
+            // Performance counters are used by driver calls of EEPROM emulation init
+            #if ( 1 == NVM_CFG_STATS_EN )
+                status |= nvm_stats_init();
+            #endif
+
+            // Init NVM EEPROM Emulation
+            status |= nvm_ee_init();
+
+            // Init write and read caches
+            #if ( 1 == NVM_CFG_WCACHE_EN )
+                status |= nvm_wcache_init();
+            #endif
+
+            #if ( 1 == NVM_CFG_RCACHE_EN )
+                status |= nvm_rcache_init();
+            #endif
+
+            // Drop asynchronous requests of previous session
+            #if ( 1 == NVM_CFG_ASYNC_EN )
+                memset( &g_async_queue, 0, sizeof( g_async_queue ));
+            #endif
+
+            #if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+                memset( &g_write_skip_cnt, 0, sizeof( g_write_skip_cnt ));
+            #endif
+
+            // Integrity of regions is checked again at first access
+            #if ( 1 == NVM_CFG_CRC_EN )
+                memset( &g_crc_drv, 0, sizeof( g_crc_drv ));
+            #endif
+
+    		// Init NVM interface
+    		status |= nvm_if_init();
+
+    		// Init success
+    		if ( eNVM_OK == status )
+    		{
+    			gb_is_init = true;
+    		}
+        }
+
+        // Invalid NVM configuration
+        else
+        {
+            status = eNVM_ERROR;
+
+            NVM_DBG_PRINT( "NVM: Configuration invalid!" );
+            NVM_ASSERT( 0 );
+        }
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		De-Initialized NVM memory drivers
+*
+* @note		EEPROM emulated regions must be synced beforehand by *nvm_sync*.
+*			Otherwise error is returned and module stays initialized.
+*
+* @return 	status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_deinit(void)
+{
+    nvm_status_t status = eNVM_OK;
+    
+    if ( true == gb_is_init )
+    {
+        // Cached writes must reach device
+        #if ( 1 == NVM_CFG_WCACHE_EN )
+            status |= nvm_flush();
+        #endif
+
+        // Release EEPROM emulation, next init loads regions from flash. Refused
+        // while any region is not synced, then drivers stay initialized too.
+        if ( eNVM_OK == status )
+        {
+            status = nvm_ee_deinit();
+        }
+
+        if ( eNVM_OK == status )
+        {
+            // Low level driver de-init
+            for ( uint32_t mem_drv_num = 0; mem_drv_num < eNVM_MEM_DRV_NUM_OF; mem_drv_num++ )
+            {
+                if ( NULL != gp_nvm_drivers[mem_drv_num].pf_nvm_deinit )
+                {
+                    status |= gp_nvm_drivers[mem_drv_num].pf_nvm_deinit();
+
+                    NVM_DBG_PRINT( "NVM: Low level memory driver #%d de-initialize with status: %s", mem_drv_num, nvm_get_status_str( status ));
+                }
+            } 
+        }
+
+        // De-init success
+        if ( eNVM_OK == status )
+        {
+            gb_is_init = false;
+        }
+    }
+    else
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get NVM initialization state
+*
+* @param[out]   p_is_init   - Pointer to init flag
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_is_init(bool * const p_is_init)
+{
+    nvm_status_t status = eNVM_OK;
+
+    if ( NULL != p_is_init )
+    {
+        *p_is_init = gb_is_init;
+    }
+    else
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write data to NVM region
+*
+* @note		Input address argument of write function in NVM region is
+* 			offset by defined start address of region!
+*
+* @param[in]	region	- NVM region defined in config table
+* @param[in]	addr	- Start region address + address
+* @param[in]	size	- Size of written data in bytes
+* @param[in]	p_data	- Pointer to written data
+* @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
 nvm_status_t nvm_write(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
 {
 	nvm_status_t status = eNVM_OK;
 
+    #if ( 1 == NVM_CFG_STATS_EN )
+        const uint32_t ts = nvm_if_get_timestamp();
+    #endif
+
+	NVM_ASSERT( true == gb_is_init );
+	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+	NVM_ASSERT(		(( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + nvm_get_data_size( region )))
+				&& 	( size <= nvm_get_data_size( region )));
+
+    // Is init and valid range
+	if  (   ( true == gb_is_init )
+        &&  ( region < eNVM_REGION_NUM_OF  ))
+	{
+		// Valid address and size
+		if (    (( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + nvm_get_data_size( region )))
+            && 	( size <= nvm_get_data_size( region )))
+		{
+			#if ( 1 == NVM_CFG_MUTEX_EN )
+				if ( eNVM_OK == nvm_lock_region( region ))
+				{
+			#endif
+                    #if ( 1 == NVM_CFG_STATS_EN )
+                        nvm_stats_enter( region, ts );
+                    #endif
+
+                    // Data already stored - no sync or program cycle needed
+                    #if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+                        if ( true == nvm_write_is_unchanged( region, addr, size, p_data ))
+                        {
+                            g_write_skip_cnt[ nvm_get_drv( region ) ]++;
+                        }
+                        else
+                    #endif
+
+                    // EEPROM emulated region
+                    if ( true == gp_nvm_regions[region].p_driver->ee_en )
+                    {
+                        status = nvm_ee_write( region, addr, size, p_data );
+                    }
+
+                    // Asynchronous transfer in flight
+                    #if ( 1 == NVM_CFG_ASYNC_EN )
+                        else if ( true == nvm_async_is_busy( region ))
+                        {
+                            status = eNVM_ERROR;
+                        }
+                    #endif
+
+                    // Simple write (through optional caches)
+                    else
+                    {
+                        #if ( 1 == NVM_CFG_CRC_EN )
+                            nvm_crc_touch_drv( region );
+                        #endif
+
+    					status = nvm_drv_write( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + addr, size, p_data );
+                    }
+
+                    #if ( 1 == NVM_CFG_STATS_EN )
+                        nvm_stats_exit( region, eNVM_STATS_OP_WRITE, size, ts );
+                    #endif
+
+			#if ( 1 == NVM_CFG_MUTEX_EN )
+					nvm_unlock_region( region );
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = eNVM_ERROR;
+				}
+			#endif
+		}
+		else
+		{
+			status = eNVM_ERROR;
+		}
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	NVM_TRACE( eNVM_TRACE_WRITE, region, addr, size, status );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read data from NVM region
+*
+* @note		Input address argument of write function in NVM region is
+* 			offset by defined start address of region!
+*
+* @param[in]	region	- NVM region defined in config table
+* @param[in]	addr	- Start region address + address
+* @param[in]	size	- Size of written data in bytes
+* @param[in]	p_data	- Pointer to read data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_read(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	nvm_status_t status = eNVM_OK;
+
+    #if ( 1 == NVM_CFG_STATS_EN )
+        const uint32_t ts = nvm_if_get_timestamp();
+    #endif
+
+	NVM_ASSERT( true == gb_is_init );
+	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+	NVM_ASSERT(		(( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + nvm_get_data_size( region )))
+				&& 	( size <= nvm_get_data_size( region )));
+
+    // Is init and valid range
+	if  (   ( true == gb_is_init )
+        &&  ( region < eNVM_REGION_NUM_OF  ))
+	{
+		// Valid address and size
+		if (    (( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + nvm_get_data_size( region )))
+            && 	( size <= nvm_get_data_size( region )))
+		{
+            bool done = false;
+
+            // Lock-free read of EEPROM emulated region
+            #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+                done = ( eNVM_OK == nvm_ee_read_seqlock( region, addr, size, p_data ));
+
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    if ( true == done )
+                    {
+                        nvm_stats_add_read_lockfree( region, size );
+                    }
+                #endif
+            #endif
+
+            // Locked read
+            if ( false == done )
+            {
+				#if ( 1 == NVM_CFG_MUTEX_EN )
+					if ( eNVM_OK == nvm_lock_region( region ))
+					{
+				#endif
+                        #if ( 1 == NVM_CFG_STATS_EN )
+                            nvm_stats_enter( region, ts );
+                        #endif
+
+                        // EEPROM emulated region
+                        if ( true == gp_nvm_regions[region].p_driver->ee_en )
+                        {
+                            status = nvm_ee_read( region, addr, size, p_data );
+                        }
+
+                        // Asynchronous transfer in flight
+                        #if ( 1 == NVM_CFG_ASYNC_EN )
+                            else if ( true == nvm_async_is_busy( region ))
+                            {
+                                status = eNVM_ERROR;
+                            }
+                        #endif
+
+                        // Simple read (through optional caches)
+                        else
+                        {
+							status = nvm_drv_read( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + addr, size, p_data );
+
+                            // Integrity of region
+                            #if ( 1 == NVM_CFG_CRC_EN )
+                                if ( eNVM_OK == status )
+                                {
+                                    status = nvm_crc_verify_drv( region );
+                                }
+                            #endif
+                        }
+
+                        #if ( 1 == NVM_CFG_STATS_EN )
+                            nvm_stats_exit( region, eNVM_STATS_OP_READ, size, ts );
+                        #endif
+
+				#if ( 1 == NVM_CFG_MUTEX_EN )
+						nvm_unlock_region( region );
+					}
+
+					// Mutex not acquire
+					else
+					{
+						status = eNVM_ERROR;
+					}
+				#endif
+            }
+		}
+		else
+		{
+			status = eNVM_ERROR;
+		}
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	NVM_TRACE( eNVM_TRACE_READ, region, addr, size, status );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase data from NVM region
+*
+* @note		Input address argument of write function in NVM region is
+* 			offset by defined start address of region!
+*
+* @param[in]	region	- NVM region defined in config table
+* @param[in]	addr	- Start region address + address
+* @param[in]	size	- Size of written data in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_erase(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+{
+	nvm_status_t status = eNVM_OK;
+
+    #if ( 1 == NVM_CFG_STATS_EN )
+        const uint32_t ts = nvm_if_get_timestamp();
+    #endif
+
+	NVM_ASSERT( true == gb_is_init );
+	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+	NVM_ASSERT(		(( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + nvm_get_data_size( region )))
+				&& 	( size <= nvm_get_data_size( region )));
+
+    // Is init and valid range
+	if  (   ( true == gb_is_init )
+        &&  ( region < eNVM_REGION_NUM_OF  ))
+	{
+		// Valid address and size
+		if (    (( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + nvm_get_data_size( region )))
+            && 	( size <= nvm_get_data_size( region )))
+		{
+			#if ( 1 == NVM_CFG_MUTEX_EN )
+				if ( eNVM_OK == nvm_lock_region( region ))
+				{
+			#endif
+                    #if ( 1 == NVM_CFG_STATS_EN )
+                        nvm_stats_enter( region, ts );
+                    #endif
+
+                    // EEPROM emulated region
+                    if ( true == gp_nvm_regions[region].p_driver->ee_en )
+                    {
+                        status = nvm_ee_erase( region, addr, size );
+                    }
+
+                    // Asynchronous transfer in flight
+                    #if ( 1 == NVM_CFG_ASYNC_EN )
+                        else if ( true == nvm_async_is_busy( region ))
+                        {
+                            status = eNVM_ERROR;
+                        }
+                    #endif
+
+                    // Simple erase (through optional caches)
+                    else
+                    {
+                        #if ( 1 == NVM_CFG_CRC_EN )
+                            nvm_crc_touch_drv( region );
+                        #endif
+
+                        status = nvm_drv_erase( nvm_get_drv( region ), gp_nvm_regions[region].start_addr + addr, size );
+                    }
+
+                    #if ( 1 == NVM_CFG_STATS_EN )
+                        nvm_stats_exit( region, eNVM_STATS_OP_ERASE, size, ts );
+                    #endif
+
+			#if ( 1 == NVM_CFG_MUTEX_EN )
+					nvm_unlock_region( region );
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = eNVM_ERROR;
+				}
+			#endif
+		}
+		else
+		{
+			status = eNVM_ERROR;
+		}
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	NVM_TRACE( eNVM_TRACE_ERASE, region, addr, size, status );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sync NVM region
+*
+* @brief    When region is using EEPROM emulated memory driver this function
+*           moved data from RAM to FLASH
+*
+* @param[in]	region	- NVM region defined in config table
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sync(const nvm_region_name_t region)
+{
+	nvm_status_t status = eNVM_OK;
+
+    #if ( 1 == NVM_CFG_STATS_EN )
+        const uint32_t ts = nvm_if_get_timestamp();
+    #endif
+
 	NVM_ASSERT( true == gb_is_init );
-	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
-	NVM_ASSERT(		(( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size ))
-				&& 	( size <= gp_nvm_regions[region].size ));
+    NVM_ASSERT( region < eNVM_REGION_NUM_OF );
 
-    // Is init and valid range
+	// Check init
 	if  (   ( true == gb_is_init )
-        &&  ( region < eNVM_REGION_NUM_OF  ))
+        &&  ( region < eNVM_REGION_NUM_OF ))
 	{
-		// Valid address and size
-		if (    (( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size ))
-            && 	( size <= gp_nvm_regions[region].size ))
-		{
-			#if ( 1 == NVM_CFG_MUTEX_EN )
-				if ( eNVM_OK == nvm_if_aquire_mutex())
-				{
-			#endif
-                    // EEPROM emulated region
-                    if ( true == gp_nvm_regions[region].p_driver->ee_en )
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+            if ( eNVM_OK == nvm_if_aquire_mutex())
+            {
+        #endif
+
+        // Asynchronous sync in progress must be completed first
+        #if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+            nvm_sync_job_finish();
+        #endif
+
+        // Sync local RAM data to FLASH memory
+        // NOTE: Global mutex protects shared sync resources (page buffer),
+        //       memory driver lock protects region data!
+        #if ( 1 == NVM_DRV_LOCK_EN )
+            if ( eNVM_OK == nvm_if_aquire_drv_mutex( nvm_get_drv( region )))
+            {
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    nvm_stats_enter( region, ts );
+                #endif
+
+                status = nvm_ee_sync( region );
+
+                #if ( 1 == NVM_CFG_CRC_EN )
+                    status |= nvm_crc_update_drv( region );
+                #endif
+
+                #if ( 1 == NVM_CFG_WCACHE_EN )
+                    status |= nvm_wcache_flush( nvm_get_drv( region ));
+                #endif
+
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    nvm_stats_exit( region, eNVM_STATS_OP_SYNC, 0U, ts );
+                #endif
+
+                nvm_if_release_drv_mutex( nvm_get_drv( region ));
+            }
+            else
+            {
+                status = eNVM_ERROR;
+            }
+        #else
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_enter( region, ts );
+            #endif
+
+            status = nvm_ee_sync( region );
+
+            #if ( 1 == NVM_CFG_CRC_EN )
+                status |= nvm_crc_update_drv( region );
+            #endif
+
+            #if ( 1 == NVM_CFG_WCACHE_EN )
+                status |= nvm_wcache_flush( nvm_get_drv( region ));
+            #endif
+
+            #if ( 1 == NVM_CFG_STATS_EN )
+                nvm_stats_exit( region, eNVM_STATS_OP_SYNC, 0U, ts );
+            #endif
+        #endif
+
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+                nvm_if_release_mutex();
+            }
+
+            // Mutex not acquire
+            else
+            {
+                status = eNVM_ERROR;
+            }
+        #endif
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	NVM_TRACE( eNVM_TRACE_SYNC, region, 0U, 0U, status );
+
+	return status;    
+}
+
+#if ( 1 == NVM_CFG_EE_AB_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Erase inactive slot of A/B region
+    *
+    * @brief    Moves erase of previous content out of next sync, which then
+    *           only programs inactive slot and commits it. Intended to be
+    *           called at idle time after sync.
+    *
+    * @note     Has no effect on region without A/B slots. After erase only
+    *           active slot holds region content.
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_ab_erase_inactive(const nvm_region_name_t region)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF ))
+        {
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_if_aquire_mutex())
+                {
+            #endif
+
+            // Asynchronous sync might be programming inactive slot
+            #if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+                nvm_sync_job_finish();
+            #endif
+
+            #if ( 1 == NVM_DRV_LOCK_EN )
+                if ( eNVM_OK == nvm_if_aquire_drv_mutex( nvm_get_drv( region )))
+                {
+                    #if ( 1 == NVM_CFG_STATS_EN )
+                        nvm_stats_attach( region );
+                    #endif
+
+                    status = nvm_ee_ab_erase_inactive( region );
+
+                    #if ( 1 == NVM_CFG_STATS_EN )
+                        nvm_stats_detach( region );
+                    #endif
+
+                    nvm_if_release_drv_mutex( nvm_get_drv( region ));
+                }
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #else
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    nvm_stats_attach( region );
+                #endif
+
+                status = nvm_ee_ab_erase_inactive( region );
+
+                #if ( 1 == NVM_CFG_STATS_EN )
+                    nvm_stats_detach( region );
+                #endif
+            #endif
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_if_release_mutex();
+                }
+
+                // Mutex not acquire
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        NVM_TRACE( eNVM_TRACE_AB_ERASE, region, 0U, 0U, status );
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_WCACHE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Flush write caches of all memory drivers
+    *
+    * @brief    Programs all pages held by write caches to memory devices.
+    *           Use before power down or reset.
+    *
+    * @note     nvm_sync() flushes write cache of region memory driver only.
+    *
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_flush(void)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+
+        if ( true == gb_is_init )
+        {
+            for ( uint32_t drv = 0U; drv < eNVM_MEM_DRV_NUM_OF; drv++ )
+            {
+                #if ( 1 == NVM_CFG_MUTEX_EN )
+                    if ( eNVM_OK == nvm_lock_drv((nvm_mem_drv_name_t) drv ))
                     {
-                        status = nvm_ee_write( region, addr, size, p_data );
+                #endif
+
+                status |= nvm_wcache_flush((nvm_mem_drv_name_t) drv );
+
+                #if ( 1 == NVM_CFG_MUTEX_EN )
+                        nvm_unlock_drv((nvm_mem_drv_name_t) drv );
                     }
 
-                    // Simple write
+                    // Mutex not acquire
                     else
                     {
-    					// Write
-    					if ( eNVM_OK != gp_nvm_regions[region].p_driver->pf_nvm_write( gp_nvm_regions[region].start_addr + addr, size, p_data ))
-    					{
-    						status = eNVM_ERROR;
-    					}
+                        status = eNVM_ERROR;
                     }
+                #endif
+            }
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        NVM_TRACE( eNVM_TRACE_FLUSH, NVM_TRACE_NO_REGION, 0U, 0U, status );
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_RCACHE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get read cache counters of memory driver
+    *
+    * @note     Counters are in cache blocks (NVM_CFG_RCACHE_BLOCK_SIZE). Read
+    *           bypassing cache counts as single miss.
+    *
+    * @param[in]	drv	    - Memory driver
+    * @param[out]	p_hit	- Number of blocks served from cache
+    * @param[out]	p_miss	- Number of blocks read from memory device
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_get_rcache_stats(const nvm_mem_drv_name_t drv, uint32_t * const p_hit, uint32_t * const p_miss)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( drv < eNVM_MEM_DRV_NUM_OF );
+        NVM_ASSERT( NULL != p_hit );
+        NVM_ASSERT( NULL != p_miss );
+
+        if  (   ( true == gb_is_init )
+            &&  ( drv < eNVM_MEM_DRV_NUM_OF )
+            &&  ( NULL != p_hit )
+            &&  ( NULL != p_miss ))
+        {
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_lock_drv( drv ))
+                {
+            #endif
+
+            nvm_rcache_get_stats( drv, p_hit, p_miss );
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_unlock_drv( drv );
+                }
+
+                // Mutex not acquire
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get number of skipped writes of memory driver
+    *
+    * @note     Counts calls of nvm_write() dropped because data was already
+    *           stored. Counter is cleared by nvm_init().
+    *
+    * @param[in]	drv	    - Memory driver
+    * @param[out]	p_cnt	- Number of skipped writes
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_get_write_skip_cnt(const nvm_mem_drv_name_t drv, uint32_t * const p_cnt)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( drv < eNVM_MEM_DRV_NUM_OF );
+        NVM_ASSERT( NULL != p_cnt );
+
+        if  (   ( true == gb_is_init )
+            &&  ( drv < eNVM_MEM_DRV_NUM_OF )
+            &&  ( NULL != p_cnt ))
+        {
+            *p_cnt = g_write_skip_cnt[drv];
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get performance counters of NVM region
+    *
+    * @note     Counters are cleared by nvm_init() and nvm_reset_stats().
+    *           Time is in units of nvm_if_get_timestamp().
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[out]	p_stats	- Region counters
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_get_stats(const nvm_region_name_t region, nvm_stats_t * const p_stats)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+        NVM_ASSERT( NULL != p_stats );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF )
+            &&  ( NULL != p_stats ))
+        {
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_lock_region( region ))
+                {
+            #endif
+
+            nvm_stats_get( region, p_stats );
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_unlock_region( region );
+                }
+
+                // Mutex not acquire
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Reset performance counters of NVM region
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_reset_stats(const nvm_region_name_t region)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF ))
+        {
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_lock_region( region ))
+                {
+            #endif
+
+            nvm_stats_reset( region );
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_unlock_region( region );
+                }
+
+                // Mutex not acquire
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get recorded trace events
+    *
+    * @note     Newest events are copied, oldest first. Trace is kept over
+    *           nvm_init(), so it can be read out also before initialization.
+    *
+    * @param[out]	p_evt	- Events
+    * @param[in]	max	    - Maximum number of events to copy
+    * @param[out]	p_num	- Number of copied events
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_get_trace(nvm_trace_evt_t * const p_evt, const uint32_t max, uint32_t * const p_num)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( NULL != p_evt );
+        NVM_ASSERT( NULL != p_num );
+
+        if  (   ( NULL != p_evt )
+            &&  ( NULL != p_num ))
+        {
+            *p_num = nvm_trace_get( p_evt, max );
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Drop recorded trace events
+    *
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_clear_trace(void)
+    {
+        nvm_trace_clear();
+
+        return eNVM_OK;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Decode trace event to text
+    *
+    * @note     Events can be transferred in binary form and decoded
+    *           elsewhere, e.g. by host tool built with NVM sources.
+    *
+    * @param[in]	p_evt	- Event
+    * @param[out]	p_str	- Text, always null terminated
+    * @param[in]	size	- Size of text buffer
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_decode_trace(const nvm_trace_evt_t * const p_evt, char * const p_str, const uint32_t size)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( NULL != p_evt );
+        NVM_ASSERT( NULL != p_str );
+        NVM_ASSERT( size > 0U );
+
+        if  (   ( NULL != p_evt )
+            &&  ( NULL != p_str )
+            &&  ( size > 0U ))
+        {
+            nvm_trace_decode( p_evt, p_str, size );
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Print all recorded trace events
+    *
+    * @note     Events are printed oldest first, one call of print function
+    *           per event. Trace is not cleared.
+    *
+    * @param[in]	pf_print	- Print function
+    * @return 		status	    - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_dump_trace(pf_nvm_trace_print_t pf_print)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( NULL != pf_print );
+
+        if ( NULL != pf_print )
+        {
+            nvm_trace_dump( pf_print );
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Prefetch NVM region
+*
+* @brief    When region is using EEPROM emulated memory driver and lazy load
+*           is enabled this function copies region from FLASH to RAM before
+*           first access.
+*
+* @param[in]	region	- NVM region defined in config table
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_prefetch(const nvm_region_name_t region)
+{
+	nvm_status_t status = eNVM_OK;
+
+	NVM_ASSERT( true == gb_is_init );
+    NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+
+	// Check init
+	if  (   ( true == gb_is_init )
+        &&  ( region < eNVM_REGION_NUM_OF ))
+	{
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+            if ( eNVM_OK == nvm_lock_region( region ))
+            {
+        #endif
+
+        #if ( 1 == NVM_CFG_STATS_EN )
+            nvm_stats_attach( region );
+        #endif
+
+        // Load region from FLASH to local RAM
+        status = nvm_ee_prefetch( region );
+
+        #if ( 1 == NVM_CFG_STATS_EN )
+            nvm_stats_detach( region );
+        #endif
 
-			#if ( 1 == NVM_CFG_MUTEX_EN )
-					nvm_if_release_mutex();
-				}
+        #if ( 1 == NVM_CFG_MUTEX_EN )
+                nvm_unlock_region( region );
+            }
 
-				// Mutex not acquire
-				else
-				{
-					status = eNVM_ERROR;
-				}
-			#endif
-		}
-		else
-		{
-			status = eNVM_ERROR;
-		}
+            // Mutex not acquire
+            else
+            {
+                status = eNVM_ERROR;
+            }
+        #endif
 	}
 	else
 	{
 		status = eNVM_ERROR;
 	}
 
-	NVM_DBG_PRINT( "NVM: Writing to region <%d> addr: 0x%04X. Status: %s", region, addr, nvm_get_status_str( status ));
+	NVM_TRACE( eNVM_TRACE_PREFETCH, region, 0U, 0U, status );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Read data from NVM region
+*		Write multiple data ranges to NVM
 *
-* @note		Input address argument of write function in NVM region is
-* 			offset by defined start address of region!
+* @brief    All items are validated up front and lock is taken only once.
+*           Consecutive items that address adjacent memory of the same
+*           non-emulated memory driver are written with single driver call.
+*           If memory driver provides vectored write, non-adjacent items
+*           are written with single call as well.
 *
-* @param[in]	region	- NVM region defined in config table
-* @param[in]	addr	- Start region address + address
-* @param[in]	size	- Size of written data in bytes
-* @param[in]	p_data	- Pointer to read data
-* @return 		status	- Status of operation
+* @note     Items are executed in given order. Sort items by address to
+*           get best coalescing. Invalid items are skipped.
+*
+* @param[in,out]	p_items	- Batch items. Status of each item is returned.
+* @param[in]		num	    - Number of items
+* @return 			status	- Status of operation. Error if any item failed.
 */
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_read(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+nvm_status_t nvm_write_batch(nvm_batch_item_t * const p_items, const uint32_t num)
 {
 	nvm_status_t status = eNVM_OK;
 
 	NVM_ASSERT( true == gb_is_init );
-	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
-	NVM_ASSERT(		(( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size ))
-				&& 	( size <= gp_nvm_regions[region].size ));
+	NVM_ASSERT( NULL != p_items );
 
-    // Is init and valid range
 	if  (   ( true == gb_is_init )
-        &&  ( region < eNVM_REGION_NUM_OF  ))
+        &&  ( NULL != p_items ))
 	{
-		// Valid address and size
-		if (    (( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size ))
-            && 	( size <= gp_nvm_regions[region].size ))
-		{
-			#if ( 1 == NVM_CFG_MUTEX_EN )
-				if ( eNVM_OK == nvm_if_aquire_mutex())
-				{
-			#endif
-                    // EEPROM emulated region
-                    if ( true == gp_nvm_regions[region].p_driver->ee_en )
-                    {
-                        status = nvm_ee_read( region, addr, size, p_data );
-                    }
-
-                    // Simple read
-                    else
-                    {
-    					// Read
-    					if ( eNVM_OK != gp_nvm_regions[region].p_driver->pf_nvm_read( gp_nvm_regions[region].start_addr + addr, size, p_data ))
-    					{
-    						status = eNVM_ERROR;
-    					}
-                    }
-
-			#if ( 1 == NVM_CFG_MUTEX_EN )
-					nvm_if_release_mutex();
-				}
-
-				// Mutex not acquire
-				else
-				{
-					status = eNVM_ERROR;
-				}
-			#endif
-		}
-		else
-		{
-			status = eNVM_ERROR;
-		}
+        status = nvm_batch_execute( p_items, num, eNVM_BATCH_WRITE );
 	}
 	else
 	{
 		status = eNVM_ERROR;
 	}
 
-	NVM_DBG_PRINT( "NVM: Reading region <%d> from addr: 0x%04X. Status: %s", region, addr, nvm_get_status_str( status ));
+	NVM_TRACE( eNVM_TRACE_WRITE_BATCH, NVM_TRACE_NO_REGION, 0U, num, status );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Erase data from NVM region
+*		Read multiple data ranges from NVM
 *
-* @note		Input address argument of write function in NVM region is
-* 			offset by defined start address of region!
+* @brief    All items are validated up front and lock is taken only once.
+*           Consecutive items that address adjacent memory of the same
+*           non-emulated memory driver are read with single driver call.
+*           If memory driver provides vectored read, non-adjacent items
+*           are read with single call as well.
 *
-* @param[in]	region	- NVM region defined in config table
-* @param[in]	addr	- Start region address + address
-* @param[in]	size	- Size of written data in bytes
-* @return 		status	- Status of operation
+* @param[in,out]	p_items	- Batch items. Status of each item is returned.
+* @param[in]		num	    - Number of items
+* @return 			status	- Status of operation. Error if any item failed.
 */
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_erase(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+nvm_status_t nvm_read_batch(nvm_batch_item_t * const p_items, const uint32_t num)
 {
 	nvm_status_t status = eNVM_OK;
 
 	NVM_ASSERT( true == gb_is_init );
-	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
-	NVM_ASSERT(		(( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size ))
-				&& 	( size <= gp_nvm_regions[region].size ));
+	NVM_ASSERT( NULL != p_items );
 
-    // Is init and valid range
 	if  (   ( true == gb_is_init )
-        &&  ( region < eNVM_REGION_NUM_OF  ))
+        &&  ( NULL != p_items ))
 	{
-		// Valid address and size
-		if (    (( addr + gp_nvm_regions[region].start_addr ) < ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size ))
-            && 	( size <= gp_nvm_regions[region].size ))
-		{
-			#if ( 1 == NVM_CFG_MUTEX_EN )
-				if ( eNVM_OK == nvm_if_aquire_mutex())
-				{
-			#endif
-					
-                    // EEPROM emulated region
-                    if ( true == gp_nvm_regions[region].p_driver->ee_en )
-                    {
-                        status = nvm_ee_erase( region, addr, size );
-                    }
-
-                    // Simple erase
-                    else
-                    {
-                        // Erase
-    					if ( eNVM_OK != gp_nvm_regions[region].p_driver->pf_nvm_erase( gp_nvm_regions[region].start_addr + addr, size ))
-    					{
-    						status = eNVM_ERROR;
-    					}
-                    }
-
-			#if ( 1 == NVM_CFG_MUTEX_EN )
-					nvm_if_release_mutex();
-				}
-
-				// Mutex not acquire
-				else
-				{
-					status = eNVM_ERROR;
-				}
-			#endif
-		}
-		else
-		{
-			status = eNVM_ERROR;
-		}
+        status = nvm_batch_execute( p_items, num, eNVM_BATCH_READ );
 	}
 	else
 	{
 		status = eNVM_ERROR;
 	}
 
-	NVM_DBG_PRINT( "NVM: Erasing from region <%d> addr: 0x%04X. Status: %s", region, addr, nvm_get_status_str( status ));
+	NVM_TRACE( eNVM_TRACE_READ_BATCH, NVM_TRACE_NO_REGION, 0U, num, status );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Sync NVM region
+*		Erase multiple data ranges of NVM
 *
-* @brief    When region is using EEPROM emulated memory driver this function
-*           moved data from RAM to FLASH
+* @brief    All items are validated up front and lock is taken only once.
+*           Consecutive items of the same non-emulated memory driver are
+*           erased with single driver call, using multi-range erase if
+*           memory driver provides it.
 *
-* @param[in]	region	- NVM region defined in config table
-* @return 		status	- Status of operation
+* @note     Data buffer of items is not used.
+*
+* @param[in,out]	p_items	- Batch items. Status of each item is returned.
+* @param[in]		num	    - Number of items
+* @return 			status	- Status of operation. Error if any item failed.
 */
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_sync(const nvm_region_name_t region)
+nvm_status_t nvm_erase_batch(nvm_batch_item_t * const p_items, const uint32_t num)
 {
 	nvm_status_t status = eNVM_OK;
 
 	NVM_ASSERT( true == gb_is_init );
-    NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+	NVM_ASSERT( NULL != p_items );
 
-	// Check init
 	if  (   ( true == gb_is_init )
-        &&  ( region < eNVM_REGION_NUM_OF ))
+        &&  ( NULL != p_items ))
 	{
-        #if ( 1 == NVM_CFG_MUTEX_EN )
-            if ( eNVM_OK == nvm_if_aquire_mutex())
+        status = nvm_batch_execute( p_items, num, eNVM_BATCH_ERASE );
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	NVM_TRACE( eNVM_TRACE_ERASE_BATCH, NVM_TRACE_NO_REGION, 0U, num, status );
+
+	return status;
+}
+
+#if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Request asynchronous sync of NVM region
+    *
+    * @brief    Request is queued and executed by nvm_process() one flash
+    *           operation per call. Between calls NVM mutex is released, thus
+    *           reads and writes are served from RAM while sync is in flight.
+    *
+    *           Worker is notified about new request via nvm_if_sync_request().
+    *
+    * @note     Request for region that is already pending is merged with
+    *           pending one. Completion callback is replaced.
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[in]	pf_cb	- Completion callback. Can be NULL.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_sync_async(const nvm_region_name_t region, pf_nvm_sync_cb_t pf_cb)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+
+        // Check init
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF ))
+        {
+            // Queue request
+            status = nvm_sync_queue( region, pf_cb );
+
+            // Notify worker
+            if ( eNVM_OK == status )
             {
-        #endif
-                
-        // Sync local RAM data to FLASH memory
-        status = nvm_ee_sync( region );
+                status = nvm_if_sync_request();
+            }
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
 
-        #if ( 1 == NVM_CFG_MUTEX_EN )
-                nvm_if_release_mutex();
+        NVM_TRACE( eNVM_TRACE_SYNC_REQ, region, 0U, 0U, status );
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Start incremental sync of NVM region
+    *
+    * @brief    Sync is executed by subsequent calls of nvm_sync_step(),
+    *           therefore flash work can be interleaved with main loop.
+    *
+    * @note     Same as nvm_sync_async() without callback and without
+    *           notification of worker.
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_sync_start(const nvm_region_name_t region)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF ))
+        {
+            status = nvm_sync_queue( region, NULL );
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        NVM_TRACE( eNVM_TRACE_SYNC_REQ, region, 0U, 0U, status );
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Execute steps of started syncs
+    *
+    * @brief    Each step executes at most single flash operation: erase of
+    *           one flash page or program of one chunk (NVM_CFG_EE_SYNC_CHUNK_SIZE).
+    *           Worst-case duration of call is therefore bounded by budget.
+    *
+    * @note     NVM mutex is released between steps.
+    *
+    * @param[in]	budget	    - Maximum number of steps to execute
+    * @param[out]	p_pending	- Sync work remains
+    * @return 		status	    - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_sync_step(const uint32_t budget, bool * const p_pending)
+    {
+        nvm_status_t    status  = eNVM_OK;
+        bool            pending = true;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( NULL != p_pending );
+
+        if  (   ( true == gb_is_init )
+            &&  ( NULL != p_pending ))
+        {
+            for ( uint32_t step = 0U; ( step < budget ) && ( eNVM_OK == status ) && ( true == pending ); step++ )
+            {
+                #if ( 1 == NVM_CFG_MUTEX_EN )
+                    if ( eNVM_OK == nvm_if_aquire_mutex())
+                    {
+                #endif
+
+                status  = nvm_sync_job_step();
+                pending = nvm_sync_is_busy();
+
+                #if ( 1 == NVM_CFG_MUTEX_EN )
+                        nvm_if_release_mutex();
+                    }
+
+                    // Mutex not acquire
+                    else
+                    {
+                        status = eNVM_ERROR;
+                    }
+                #endif
             }
 
-            // Mutex not acquire
+            // Report completed requests
+            nvm_sync_report();
+
+            *p_pending = pending;
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get asynchronous sync state of NVM region
+    *
+    * @param[in]	region	    - NVM region defined in config table
+    * @param[out]	p_pending	- Sync is queued or in progress
+    * @return 		status	    - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_sync_is_pending(const nvm_region_name_t region, bool * const p_pending)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+        NVM_ASSERT( NULL != p_pending );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF )
+            &&  ( NULL != p_pending ))
+        {
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                if ( eNVM_OK == nvm_if_aquire_mutex())
+                {
+            #endif
+
+            *p_pending = g_sync_req[region].pending;
+
+            #if ( 1 == NVM_CFG_MUTEX_EN )
+                    nvm_if_release_mutex();
+                }
+
+                // Mutex not acquire
+                else
+                {
+                    status = eNVM_ERROR;
+                }
+            #endif
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Write data to NVM region asynchronously
+    *
+    * @brief    With memory driver providing asynchronous functions (e.g. DMA
+    *           backed SPI flash) transfer runs in background and CPU is free
+    *           for other work. Requests are queued per memory driver and
+    *           executed in order. Completion is reported by nvm_process().
+    *
+    *           EEPROM emulated regions and memory drivers without
+    *           asynchronous functions are written at once, completion is
+    *           still reported by nvm_process().
+    *
+    * @note     Data buffer must be valid until completion callback!
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[in]	addr	- Start region address + address
+    * @param[in]	size	- Size of written data in bytes
+    * @param[in]	p_data	- Pointer to written data
+    * @param[in]	pf_cb	- Completion callback. Can be NULL.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_write_async(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_nvm_async_cb_t pf_cb)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+        NVM_ASSERT( NULL != p_data );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF )
+            &&  ( NULL != p_data ))
+        {
+            // Valid address and size
+            if  (   ( size <= nvm_get_data_size( region ))
+                &&  ( addr <= ( nvm_get_data_size( region ) - size )))
+            {
+                status = nvm_async_queue( region, addr, size, (uint8_t*) p_data, true, pf_cb );
+            }
             else
             {
                 status = eNVM_ERROR;
             }
-        #endif
-	}
-	else
-	{
-		status = eNVM_ERROR;
-	}
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
 
-	NVM_DBG_PRINT( "NVM: Sync region <%d> status: %s", region, nvm_get_status_str( status ));
+        NVM_TRACE( eNVM_TRACE_WRITE_ASYNC, region, addr, size, status );
 
-	return status;    
-}
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Read data from NVM region asynchronously
+    *
+    * @brief    Same as nvm_write_async() but in opposite direction. Read data
+    *           are valid when completion callback reports success.
+    *
+    * @param[in]	region	- NVM region defined in config table
+    * @param[in]	addr	- Start region address + address
+    * @param[in]	size	- Size of read data in bytes
+    * @param[out]	p_data	- Pointer to read data
+    * @param[in]	pf_cb	- Completion callback. Can be NULL.
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_read_async(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_nvm_async_cb_t pf_cb)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+        NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+        NVM_ASSERT( NULL != p_data );
+
+        if  (   ( true == gb_is_init )
+            &&  ( region < eNVM_REGION_NUM_OF )
+            &&  ( NULL != p_data ))
+        {
+            // Valid address and size
+            if  (   ( size <= nvm_get_data_size( region ))
+                &&  ( addr <= ( nvm_get_data_size( region ) - size )))
+            {
+                status = nvm_async_queue( region, addr, size, p_data, false, pf_cb );
+            }
+            else
+            {
+                status = eNVM_ERROR;
+            }
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        NVM_TRACE( eNVM_TRACE_READ_ASYNC, region, addr, size, status );
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Report completion of asynchronous memory driver transfer
+    *
+    * @brief    Shall be called by memory driver when transfer started by
+    *           pf_nvm_write_async or pf_nvm_read_async is finished, usually
+    *           from DMA transfer complete interrupt. Callback of request and
+    *           start of next transfer are then executed by nvm_process(),
+    *           therefore worker calling nvm_process() should be woken up.
+    *
+    * @note     Interrupt safe. Does not take any lock.
+    *
+    * @param[in]	drv	    - Memory driver
+    * @param[in]	status	- Status of transfer
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_async_complete(const nvm_mem_drv_name_t drv, const nvm_status_t status)
+    {
+        if  (   ( true == gb_is_init )
+            &&  ( drv < eNVM_MEM_DRV_NUM_OF )
+            &&  ( true == g_async_queue[drv].busy ))
+        {
+            nvm_async_req_t * const p_req = &g_async_queue[drv].req[ g_async_queue[drv].head ];
+
+            p_req->status   = (( eNVM_OK == status ) ? eNVM_OK : eNVM_ERROR );
+            p_req->done     = true;
+        }
+    }
+
+#endif
+
+#if (( 1 == NVM_CFG_SYNC_ASYNC_EN ) || ( 1 == NVM_CFG_ASYNC_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Process asynchronous requests
+    *
+    * @brief    Reports completed asynchronous reads and writes and starts
+    *           next queued transfers. Then executes single step (single
+    *           flash operation) of pending sync and reports completed syncs.
+    *
+    * @note     Shall be called periodically from main loop or from worker
+    *           task woken up by nvm_if_sync_request() or by completion of
+    *           asynchronous transfer.
+    *
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_process(void)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+
+        if ( true == gb_is_init )
+        {
+            #if ( 1 == NVM_CFG_ASYNC_EN )
+                status |= nvm_async_process();
+            #endif
+
+            #if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+                bool pending = false;
+
+                status |= nvm_sync_step( 1U, &pending );
+            #endif
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
 
-#if ( 1 == NVM_CFG_DEBUG_EN )
+#if (( 1 == NVM_CFG_DEBUG_EN ) || ( 1 == NVM_CFG_TRACE_EN ))
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
@@ -39,6 +39,11 @@
 #define NVM_VER_MINOR		( 1 )
 #define NVM_VER_DEVELOP		( 0 )
 
+/**
+ * 	Compile time assertion
+ */
+#define NVM_STATIC_ASSERT( expr, msg )		_Static_assert( expr, msg )
+
 /**
  * 	Status
  */
@@ -46,8 +51,50 @@ typedef enum
 {
 	eNVM_OK 	= 0,		/**<Normal operation */
 	eNVM_ERROR	= 0x01,		/**<General error */
+	eNVM_ERROR_CRC	= 0x02,	/**<Integrity (CRC) check of region failed */
+	eNVM_ERROR_BUSY	= 0x04,	/**<Region is being committed, retry after sync completes */
 } nvm_status_t;
 
+/**
+ * 	Size of region integrity trailer (CRC32) in bytes
+ */
+#define NVM_CRC_SIZE		( 4U )
+
+/**
+ * 	Size of A/B slot footer (sequence number and its complement) in bytes
+ *
+ * 	@note	Footer is programmed as single unit at the end of slot. It
+ * 			takes at least one programming unit of memory driver, which
+ * 			must not exceed NVM_AB_FOOTER_MAX_SIZE.
+ */
+#define NVM_AB_FOOTER_SIZE		( 8U )
+#define NVM_AB_FOOTER_MAX_SIZE	( 32U )
+
+/**
+ * 	EEPROM emulation log area
+ *
+ * 	@note	Log area consists of "page_num" consecutive flash pages
+ * 			of driver "page_size" starting at "start_addr".
+ */
+typedef struct nvm_ee_log_s
+{
+	uint32_t	start_addr;		/**<Start address of first log page */
+	uint32_t	page_num;		/**<Number of log pages. Must be at least 2 */
+} nvm_ee_log_t;
+
+/**
+ * 	Memory range of vectored driver operation
+ *
+ * 	@note	For write "p_data" points to data to write, for read to buffer
+ * 			of read data. Not used for erase.
+ */
+typedef struct nvm_vec_s
+{
+	uint32_t	addr;			/**<Start address */
+	uint32_t	size;			/**<Size in bytes */
+	uint8_t *	p_data;			/**<Data buffer */
+} nvm_vec_t;
+
 /**
  * 	Memory device driver
  */
@@ -58,9 +105,46 @@ typedef struct nvm_mem_driver_s
 	nvm_status_t (*pf_nvm_write)	(const uint32_t addr, const uint32_t size, const uint8_t * const p_data);   /**<Write low level interface pointer function */
 	nvm_status_t (*pf_nvm_read)		(const uint32_t addr, const uint32_t size, uint8_t * const p_data);         /**<Read low level interface pointer function */
 	nvm_status_t (*pf_nvm_erase)	(const uint32_t addr, const uint32_t size);                                 /**<Erase low level interface pointer function */
+	nvm_status_t (*pf_nvm_write_v)	(const nvm_vec_t * const p_vec, const uint32_t num);                        /**<Optional multi-range write. NULL if not supported */
+	nvm_status_t (*pf_nvm_read_v)	(const nvm_vec_t * const p_vec, const uint32_t num);                        /**<Optional multi-range read. NULL if not supported */
+	nvm_status_t (*pf_nvm_erase_v)	(const nvm_vec_t * const p_vec, const uint32_t num);                        /**<Optional multi-range (multi-page) erase. NULL if not supported */
+	nvm_status_t (*pf_nvm_write_async)	(const uint32_t addr, const uint32_t size, const uint8_t * const p_data);   /**<Optional start of asynchronous write. NULL if not supported */
+	nvm_status_t (*pf_nvm_read_async)	(const uint32_t addr, const uint32_t size, uint8_t * const p_data);         /**<Optional start of asynchronous read. NULL if not supported */
+    bool wcache_en;                                                                                             /**<Enable/Disable write coalescing cache of non-emulated driver. Needs "page_size". */
+    bool rcache_en;                                                                                             /**<Enable/Disable read cache of non-emulated driver */
     bool ee_en;                                                                                                 /**<Enable/Disable EEPROM emulation switch */
+    bool prog_only_en;                                                                                          /**<Enable/Disable sync without erase when changes only clear bits. Device must allow re-program of programmed units. */
+    uint32_t page_size;                                                                                         /**<Size of flash page (erase unit) in bytes. Zero if unknown. */
+    uint32_t prog_size;                                                                                         /**<Size of programming unit in bytes. Zero if byte programmable. */
+    uint32_t mem_size;                                                                                          /**<Size of memory device in bytes. Zero if unknown. */
+    const nvm_ee_log_t * p_ee_log;                                                                              /**<Log-structured EEPROM emulation area. NULL for in-place EEPROM emulation */
 } nvm_mem_driver_t;
 
+/**
+ * 	Sync completion callback
+ */
+typedef void (*pf_nvm_sync_cb_t)(const nvm_region_name_t region, const nvm_status_t status);
+
+/**
+ * 	Asynchronous read/write completion callback
+ */
+typedef void (*pf_nvm_async_cb_t)(const nvm_region_name_t region, const uint32_t addr, const nvm_status_t status);
+
+/**
+ * 	Batch operation item
+ *
+ * 	@note	For write "p_data" points to data to write, for read to
+ * 			buffer of read data.
+ */
+typedef struct nvm_batch_item_s
+{
+	nvm_region_name_t	region;			/**<NVM region */
+	uint32_t			addr;			/**<Start address inside region */
+	uint32_t			size;			/**<Number of bytes */
+	uint8_t *			p_data;			/**<Data buffer */
+	nvm_status_t		status;			/**<Status of item operation */
+} nvm_batch_item_t;
+
 /**
  * 	Memory region
  */
@@ -70,8 +154,116 @@ typedef struct nvm_region_s
 	const uint32_t 				start_addr;		/**<Start address of region */
 	const uint32_t 				size;			/**<Size of region in bytes */
 	const nvm_mem_driver_t *	p_driver;		/**<Low level memory driver */
+	const bool					crc_en;			/**<Last NVM_CRC_SIZE bytes of region hold CRC32 of region data */
+	const bool					ab_en;			/**<Region is committed atomically to two alternating flash slots (A/B) */
 } nvm_region_t;
 
+#if ( 1 == NVM_CFG_STATS_EN )
+
+	/**
+	 * 	Counted region operations
+	 */
+	typedef enum
+	{
+		eNVM_STATS_OP_READ = 0,		/**<nvm_read() and read batch items */
+		eNVM_STATS_OP_WRITE,		/**<nvm_write() and write batch items */
+		eNVM_STATS_OP_ERASE,		/**<nvm_erase() and erase batch items */
+		eNVM_STATS_OP_SYNC,			/**<nvm_sync() and completed asynchronous syncs */
+
+		eNVM_STATS_OP_NUM_OF
+	} nvm_stats_op_t;
+
+	/**
+	 * 	Statistics of single operation kind
+	 *
+	 * 	@note	Times are in units of nvm_if_get_timestamp(). Lock-free
+	 * 			(seqlock) reads are counted in "num" and "bytes" only.
+	 */
+	typedef struct nvm_op_stats_s
+	{
+		uint32_t	num;			/**<Number of operations */
+		uint32_t	bytes;			/**<Number of bytes requested by operations */
+		uint32_t	time_max;		/**<Longest operation */
+		uint64_t	time_sum;		/**<Total time of operations, average is time_sum / num */
+	} nvm_op_stats_t;
+
+	/**
+	 * 	Region statistics
+	 *
+	 * 	@note	Memory driver calls are accounted to region being accessed
+	 * 			or synced. Calls of initialization are not accounted.
+	 */
+	typedef struct nvm_stats_s
+	{
+		nvm_op_stats_t	op[eNVM_STATS_OP_NUM_OF];				/**<Region operations */
+		uint32_t		drv_calls;								/**<Low level memory driver calls */
+		uint32_t		drv_read_bytes;							/**<Bytes read from memory device */
+		uint32_t		drv_write_bytes;						/**<Bytes written (programmed) to memory device */
+		uint32_t		drv_erase_num;							/**<Erased pages, or erase calls of driver without "page_size" */
+		uint64_t		drv_time_sum;							/**<Time spent in low level memory driver */
+		uint32_t		page_erase[NVM_CFG_STATS_PAGE_NUM];		/**<Erase count of each page, index 0 is page of region start address */
+		uint32_t		lock_wait_max;							/**<Longest wait for NVM mutex */
+		uint64_t		lock_wait_sum;							/**<Total wait for NVM mutex */
+	} nvm_stats_t;
+
+#endif
+
+#if (( 1 == NVM_CFG_TRACE_EN ) || ( 1 == NVM_CFG_DEBUG_EN ))
+
+	/**
+	 * 	Traced operations
+	 *
+	 * 	@note	Unless noted otherwise "addr" and "size" of event are taken
+	 * 			from call of operation.
+	 */
+	typedef enum
+	{
+		eNVM_TRACE_WRITE = 0,		/**<nvm_write() */
+		eNVM_TRACE_READ,			/**<nvm_read() */
+		eNVM_TRACE_ERASE,			/**<nvm_erase() */
+		eNVM_TRACE_SYNC,			/**<nvm_sync() */
+		eNVM_TRACE_PREFETCH,		/**<nvm_prefetch() */
+		eNVM_TRACE_FLUSH,			/**<nvm_flush(), no region */
+		eNVM_TRACE_AB_ERASE,		/**<nvm_ab_erase_inactive() */
+		eNVM_TRACE_WRITE_BATCH,		/**<nvm_write_batch(), no region, size is number of items */
+		eNVM_TRACE_READ_BATCH,		/**<nvm_read_batch(), no region, size is number of items */
+		eNVM_TRACE_ERASE_BATCH,		/**<nvm_erase_batch(), no region, size is number of items */
+		eNVM_TRACE_SYNC_REQ,		/**<nvm_sync_async() and nvm_sync_start() */
+		eNVM_TRACE_SYNC_DONE,		/**<Completion of asynchronous sync */
+		eNVM_TRACE_WRITE_ASYNC,		/**<nvm_write_async() */
+		eNVM_TRACE_READ_ASYNC,		/**<nvm_read_async() */
+		eNVM_TRACE_ASYNC_DONE,		/**<Completion of asynchronous read or write reported by nvm_process() */
+		eNVM_TRACE_LOG_LOAD,		/**<Load of EEPROM log, region is memory driver, addr is page, size is sequence */
+		eNVM_TRACE_LOG_COMPACT,		/**<Compaction of EEPROM log, region is memory driver, addr is page, size is sequence */
+
+		eNVM_TRACE_NUM_OF
+	} nvm_trace_op_t;
+
+#endif
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+
+	/**
+	 * 	Trace event
+	 */
+	typedef struct nvm_trace_evt_s
+	{
+		uint32_t	timestamp;		/**<Time of completion, from nvm_if_get_timestamp() */
+		uint32_t	addr;			/**<Address inside region */
+		uint32_t	size;			/**<Size in bytes */
+		uint8_t		op;				/**<Operation, nvm_trace_op_t */
+		uint8_t		region;			/**<NVM region, 0xFF if operation is not related to single region */
+		uint8_t		status;			/**<Status of operation */
+		uint8_t		reserved;		/**<Reserved */
+	} nvm_trace_evt_t;
+
+	/**
+	 * 	Print of decoded trace event
+	 */
+	typedef void (*pf_nvm_trace_print_t)(const char * const p_str);
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions Prototypes
 ////////////////////////////////////////////////////////////////////////////////
@@ -82,8 +274,57 @@ nvm_status_t 	nvm_write	(const nvm_region_name_t region, const uint32_t addr, co
 nvm_status_t 	nvm_read	(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
 nvm_status_t 	nvm_erase	(const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
 nvm_status_t    nvm_sync    (const nvm_region_name_t region);
+nvm_status_t    nvm_prefetch(const nvm_region_name_t region);
+nvm_status_t    nvm_write_batch (nvm_batch_item_t * const p_items, const uint32_t num);
+nvm_status_t    nvm_read_batch  (nvm_batch_item_t * const p_items, const uint32_t num);
+nvm_status_t    nvm_erase_batch (nvm_batch_item_t * const p_items, const uint32_t num);
+
+#if ( 1 == NVM_CFG_WCACHE_EN )
+    nvm_status_t    nvm_flush           (void);
+#endif
+
+#if ( 1 == NVM_CFG_EE_AB_EN )
+    nvm_status_t    nvm_ab_erase_inactive(const nvm_region_name_t region);
+#endif
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+    nvm_status_t    nvm_get_write_skip_cnt(const nvm_mem_drv_name_t drv, uint32_t * const p_cnt);
+#endif
+
+#if ( 1 == NVM_CFG_RCACHE_EN )
+    nvm_status_t    nvm_get_rcache_stats(const nvm_mem_drv_name_t drv, uint32_t * const p_hit, uint32_t * const p_miss);
+#endif
+
+#if ( 1 == NVM_CFG_STATS_EN )
+    nvm_status_t    nvm_get_stats       (const nvm_region_name_t region, nvm_stats_t * const p_stats);
+    nvm_status_t    nvm_reset_stats     (const nvm_region_name_t region);
+#endif
+
+#if ( 1 == NVM_CFG_SYNC_ASYNC_EN )
+    nvm_status_t    nvm_sync_async      (const nvm_region_name_t region, pf_nvm_sync_cb_t pf_cb);
+    nvm_status_t    nvm_sync_start      (const nvm_region_name_t region);
+    nvm_status_t    nvm_sync_step       (const uint32_t budget, bool * const p_pending);
+    nvm_status_t    nvm_sync_is_pending (const nvm_region_name_t region, bool * const p_pending);
+#endif
+
+#if ( 1 == NVM_CFG_ASYNC_EN )
+    nvm_status_t    nvm_write_async     (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_nvm_async_cb_t pf_cb);
+    nvm_status_t    nvm_read_async      (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_nvm_async_cb_t pf_cb);
+    void            nvm_async_complete  (const nvm_mem_drv_name_t drv, const nvm_status_t status);
+#endif
+
+#if (( 1 == NVM_CFG_SYNC_ASYNC_EN ) || ( 1 == NVM_CFG_ASYNC_EN ))
+    nvm_status_t    nvm_process         (void);
+#endif
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+    nvm_status_t    nvm_get_trace       (nvm_trace_evt_t * const p_evt, const uint32_t max, uint32_t * const p_num);
+    nvm_status_t    nvm_clear_trace     (void);
+    nvm_status_t    nvm_decode_trace    (const nvm_trace_evt_t * const p_evt, char * const p_str, const uint32_t size);
+    nvm_status_t    nvm_dump_trace      (pf_nvm_trace_print_t pf_print);
+#endif
 
-#if ( NVM_CFG_DEBUG_EN )
+#if (( 1 == NVM_CFG_DEBUG_EN ) || ( 1 == NVM_CFG_TRACE_EN ))
 	const char * nvm_get_status_str		(const nvm_status_t status);
 #endif
 
@@ -0,0 +1,48 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_crc.h
+*@brief     NVM region integrity check - CRC32
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_CRC_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_CRC_H
+#define __NVM_CRC_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == NVM_CFG_CRC_EN )
+    uint32_t    nvm_crc32           (const uint32_t crc, const uint8_t * const p_data, const uint32_t size);
+    uint32_t    nvm_crc_add_block   (const uint32_t crc, const uint32_t block_crc);
+    void        nvm_crc_set         (const uint32_t crc, uint8_t * const p_trailer);
+    uint32_t    nvm_crc_get         (const uint8_t * const p_trailer);
+#endif
+
+#endif // __NVM_CRC_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
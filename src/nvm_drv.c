@@ -0,0 +1,389 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_drv.c
+*@brief     NVM memory driver access
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_DRV
+* @{ <!-- BEGIN GROUP -->
+*
+*   Multi-range and cached access to low level memory drivers.
+*
+*   Memory driver might provide optional vectored functions that transfer
+*   multiple ranges with single call (e.g. pipelined SPI/I2C transfers).
+*   If vectored function is not provided, ranges are transfered one by one
+*   with single range driver functions.
+*
+*   Single range access of non-emulated regions goes through optional
+*   caches: read cache on top of write cache on top of memory driver.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nvm_drv.h"
+#include "nvm_wcache.h"
+#include "nvm_rcache.h"
+#include "nvm_stats.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_drv_read_backing(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read memory driver content below read cache
+*
+* @note     Data not yet programmed from write cache are included.
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    addr    - Device address
+* @param[in]    size    - Size in bytes
+* @param[out]   p_data  - Read data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_drv_read_backing(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    nvm_status_t                    status  = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv   = &((const nvm_mem_driver_t*) nvm_cfg_get_drivers())[drv];
+
+    #if ( 1 == NVM_CFG_WCACHE_EN )
+        if ( true == nvm_wcache_is_en( drv ))
+        {
+            status = nvm_wcache_read( drv, addr, size, p_data );
+        }
+        else
+    #endif
+        {
+            if ( eNVM_OK != NVM_DEV_READ( p_drv, addr, size, p_data ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_DRV_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM memory driver access API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write multiple ranges to memory driver
+*
+* @param[in]    p_drv   - Memory driver
+* @param[in]    p_vec   - Ranges to write
+* @param[in]    num     - Number of ranges
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_drv_write_v(const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num)
+{
+    nvm_status_t status = eNVM_OK;
+
+    // Single driver call
+    if ( NULL != p_drv->pf_nvm_write_v )
+    {
+        if ( eNVM_OK != NVM_DEV_WRITE_V( p_drv, p_vec, num ))
+        {
+            status = eNVM_ERROR;
+        }
+    }
+
+    // Range by range
+    else
+    {
+        for ( uint32_t i = 0U; ( i < num ) && ( eNVM_OK == status ); i++ )
+        {
+            if ( eNVM_OK != NVM_DEV_WRITE( p_drv, p_vec[i].addr, p_vec[i].size, p_vec[i].p_data ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read multiple ranges from memory driver
+*
+* @param[in]    p_drv   - Memory driver
+* @param[in]    p_vec   - Ranges to read
+* @param[in]    num     - Number of ranges
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_drv_read_v(const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num)
+{
+    nvm_status_t status = eNVM_OK;
+
+    // Single driver call
+    if ( NULL != p_drv->pf_nvm_read_v )
+    {
+        if ( eNVM_OK != NVM_DEV_READ_V( p_drv, p_vec, num ))
+        {
+            status = eNVM_ERROR;
+        }
+    }
+
+    // Range by range
+    else
+    {
+        for ( uint32_t i = 0U; ( i < num ) && ( eNVM_OK == status ); i++ )
+        {
+            if ( eNVM_OK != NVM_DEV_READ( p_drv, p_vec[i].addr, p_vec[i].size, p_vec[i].p_data ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase multiple ranges of memory driver
+*
+* @note     Data pointer of ranges is not used.
+*
+* @param[in]    p_drv   - Memory driver
+* @param[in]    p_vec   - Ranges to erase
+* @param[in]    num     - Number of ranges
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_drv_erase_v(const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num)
+{
+    nvm_status_t status = eNVM_OK;
+
+    // Single driver call
+    if ( NULL != p_drv->pf_nvm_erase_v )
+    {
+        if ( eNVM_OK != NVM_DEV_ERASE_V( p_drv, p_vec, num ))
+        {
+            status = eNVM_ERROR;
+        }
+    }
+
+    // Range by range
+    else
+    {
+        for ( uint32_t i = 0U; ( i < num ) && ( eNVM_OK == status ); i++ )
+        {
+            if ( eNVM_OK != NVM_DEV_ERASE( p_drv, p_vec[i].addr, p_vec[i].size ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write to memory driver
+*
+* @brief    Write goes through write cache if enabled for driver. Blocks
+*           held by read cache are updated.
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    addr    - Device address
+* @param[in]    size    - Size in bytes
+* @param[in]    p_data  - Data to write
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_drv_write(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    nvm_status_t                    status  = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv   = &((const nvm_mem_driver_t*) nvm_cfg_get_drivers())[drv];
+
+    #if ( 1 == NVM_CFG_WCACHE_EN )
+        if ( true == nvm_wcache_is_en( drv ))
+        {
+            status = nvm_wcache_write( drv, addr, size, p_data );
+        }
+        else
+    #endif
+        {
+            if ( eNVM_OK != NVM_DEV_WRITE( p_drv, addr, size, p_data ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+
+    #if ( 1 == NVM_CFG_RCACHE_EN )
+        if ( true == nvm_rcache_is_en( drv ))
+        {
+            if ( eNVM_OK == status )
+            {
+                nvm_rcache_update( drv, addr, size, p_data );
+            }
+
+            // Device content unknown
+            else
+            {
+                nvm_rcache_invalidate( drv, addr, size );
+            }
+        }
+    #endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read from memory driver
+*
+* @brief    Read goes through read cache if enabled for driver, then
+*           through write cache if enabled for driver.
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    addr    - Device address
+* @param[in]    size    - Size in bytes
+* @param[out]   p_data  - Read data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_drv_read(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    nvm_status_t status = eNVM_OK;
+
+    #if ( 1 == NVM_CFG_RCACHE_EN )
+        if ( true == nvm_rcache_is_en( drv ))
+        {
+            status = nvm_rcache_read( drv, addr, size, p_data, nvm_drv_read_backing );
+        }
+        else
+    #endif
+        {
+            status = nvm_drv_read_backing( drv, addr, size, p_data );
+        }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase memory driver
+*
+* @brief    Erase goes through write cache if enabled for driver. Blocks
+*           held by read cache are invalidated.
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    addr    - Device address
+* @param[in]    size    - Size in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_drv_erase(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size)
+{
+    nvm_status_t                    status  = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv   = &((const nvm_mem_driver_t*) nvm_cfg_get_drivers())[drv];
+
+    #if ( 1 == NVM_CFG_WCACHE_EN )
+        if ( true == nvm_wcache_is_en( drv ))
+        {
+            status = nvm_wcache_erase( drv, addr, size );
+        }
+        else
+    #endif
+        {
+            if ( eNVM_OK != NVM_DEV_ERASE( p_drv, addr, size ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+
+    #if ( 1 == NVM_CFG_RCACHE_EN )
+        nvm_rcache_invalidate( drv, addr, size );
+    #endif
+
+    return status;
+}
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Compare data with memory driver content
+    *
+    * @brief    Content is read back in chunks of NVM_CFG_WRITE_SKIP_BUF_SIZE
+    *           through read and write cache and compare stops at first
+    *           difference.
+    *
+    * @param[in]    drv     - Memory driver
+    * @param[in]    addr    - Device address
+    * @param[in]    size    - Size in bytes
+    * @param[in]    p_data  - Data to compare
+    * @param[out]   p_equal - Data equal to device content
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_drv_compare(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, bool * const p_equal)
+    {
+        nvm_status_t    status                              = eNVM_OK;
+        uint8_t         buf[NVM_CFG_WRITE_SKIP_BUF_SIZE]    = { 0 };
+        uint32_t        done                                = 0U;
+        uint32_t        chunk                               = 0U;
+
+        *p_equal = true;
+
+        while   (   ( eNVM_OK == status )
+                &&  ( true == *p_equal )
+                &&  ( done < size ))
+        {
+            chunk = (( size - done ) < NVM_CFG_WRITE_SKIP_BUF_SIZE ) ? ( size - done ) : NVM_CFG_WRITE_SKIP_BUF_SIZE;
+
+            status = nvm_drv_read( drv, addr + done, chunk, buf );
+
+            *p_equal = (( eNVM_OK == status ) && ( 0 == memcmp( buf, &p_data[done], chunk )));
+
+            done += chunk;
+        }
+
+        return status;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,52 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_drv.h
+*@brief     NVM memory driver access
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_DRV_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_DRV_H
+#define __NVM_DRV_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t    nvm_drv_write_v (const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num);
+nvm_status_t    nvm_drv_read_v  (const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num);
+nvm_status_t    nvm_drv_erase_v (const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num);
+nvm_status_t    nvm_drv_write   (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t    nvm_drv_read    (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+nvm_status_t    nvm_drv_erase   (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size);
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+    nvm_status_t nvm_drv_compare(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, bool * const p_equal);
+#endif
+
+#endif // __NVM_DRV_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
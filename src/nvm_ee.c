@@ -25,11 +25,104 @@
 #include <string.h>
 
 #include "nvm_ee.h"
+#include "nvm_ee_log.h"
+#include "nvm_drv.h"
+#include "nvm_crc.h"
+#include "nvm_stats.h"
+
+#if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+    #include <stdatomic.h>
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ *  Number of bits in dirty bitmap word
+ */
+#define NVM_EE_DIRTY_WORD_BITS          ( 32U )
+
+/**
+ *  Size of buffer used to check flash content for program-only sync
+ */
+#define NVM_EE_PROG_CHECK_BUF_SIZE      ( 32U )
+
+/**
+ *  Number of flash slots of A/B region
+ */
+#define NVM_EE_AB_SLOT_NUM              ( 2U )
+
+#if ( 1 == NVM_CFG_EE_STATIC_RAM_EN )
+
+    /**
+     *  Maximum number of dirty bitmap words for static RAM space
+     *
+     *  @note   Each region needs at most one additional word due to rounding.
+     */
+    #define NVM_EE_DIRTY_WORDS_MAX      (( NVM_CFG_EE_RAM_SIZE / ( NVM_CFG_EE_BLOCK_SIZE * NVM_EE_DIRTY_WORD_BITS )) + eNVM_REGION_NUM_OF )
+
+    /**
+     *  Maximum number of dirty bitmap words of single region
+     */
+    #define NVM_EE_SYNC_MASK_WORDS_MAX  (( NVM_CFG_EE_RAM_SIZE / ( NVM_CFG_EE_BLOCK_SIZE * NVM_EE_DIRTY_WORD_BITS )) + 1U )
+
+    #if ( 1 == NVM_CFG_CRC_EN )
+
+        /**
+         *  Maximum number of block CRCs for static RAM space
+         *
+         *  @note   Each region needs at most one additional block due to rounding.
+         */
+        #define NVM_EE_CRC_BLOCKS_MAX   (( NVM_CFG_EE_RAM_SIZE / NVM_CFG_CRC_BLOCK_SIZE ) + eNVM_REGION_NUM_OF )
+
+    #endif
+
+#endif
+
+/**
+ *  EEPROM emulated region control
+ */
+typedef struct
+{
+    uint32_t    ram_offset; /**<Start of region inside RAM space */
+    uint32_t *  p_dirty;    /**<Dirty blocks bitmap, one bit per NVM_CFG_EE_BLOCK_SIZE bytes */
+    bool        dirty;      /**<At least one block of region is dirty */
+    bool        loaded;     /**<Region content is copied from flash to RAM */
+
+    #if ( 1 == NVM_CFG_CRC_EN )
+        uint32_t *  p_crc;  /**<CRC of each NVM_CFG_CRC_BLOCK_SIZE bytes of region data */
+        bool    crc_ok;     /**<Integrity trailer of region matches RAM content */
+    #endif
+
+    #if ( 1 == NVM_CFG_EE_AB_EN )
+        uint32_t    ab_seq;     /**<Sequence number of active slot */
+        uint32_t    ab_slot;    /**<Active slot, 0 for A and 1 for B */
+        bool        ab_erased;  /**<Inactive slot is erased and ready for commit */
+        bool        ab_busy;    /**<Commit into inactive slot in progress. Guarded by memory driver lock. */
+    #endif
+
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        atomic_uint seq;    /**<Sequence counter of RAM content. Odd while being modified. */
+    #endif
+} nvm_ee_region_t;
+
+/**
+ *  Sync job
+ *
+ *  @note   Sync is executed in steps, so that flash operations of long
+ *          sync can be interleaved with other NVM accesses.
+ */
+typedef struct
+{
+    const uint8_t *     p_src;      /**<Data of flash page being programmed */
+    nvm_region_name_t   region;     /**<Region being synced */
+    uint32_t            page_addr;  /**<Flash page being synced */
+    uint32_t            prog_addr;  /**<Next address to program inside page */
+    bool                erased;     /**<Flash page is erased (or prepared for program-only) and being programmed */
+    bool                prog_only;  /**<Only dirty blocks of page are programmed, page is not erased */
+    bool                active;     /**<Sync in progress */
+} nvm_ee_sync_job_t;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
@@ -51,45 +144,260 @@ static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
  */
 static uint8_t * gp_ram_mem = NULL;
 
+/**
+ *  Dirty blocks bitmaps of all EEPROM emulated regions
+ */
+static uint32_t * gp_dirty_mem = NULL;
+
+/**
+ *  Dirty blocks being synced
+ *
+ *  @note   Dirty bitmap of region is moved here at start of page by page
+ *          sync, so that writes during sync are tracked for next sync.
+ */
+static uint32_t * gp_sync_mask = NULL;
+
+#if ( 1 == NVM_CFG_CRC_EN )
+
+    /**
+     *  Block CRCs of all EEPROM emulated regions with integrity trailer
+     */
+    static uint32_t * gp_crc_mem = NULL;
+
+#endif
+
+#if ( 1 == NVM_CFG_EE_STATIC_RAM_EN )
+
+    /**
+     *  Statically allocated RAM space and dirty bitmaps
+     */
+    static uint8_t  g_ram_mem[NVM_CFG_EE_RAM_SIZE]          = { 0 };
+    static uint32_t g_dirty_mem[NVM_EE_DIRTY_WORDS_MAX]     = { 0 };
+    static uint32_t g_sync_mask[NVM_EE_SYNC_MASK_WORDS_MAX] = { 0 };
+
+    #if ( 1 == NVM_CFG_CRC_EN )
+        static uint32_t g_crc_mem[NVM_EE_CRC_BLOCKS_MAX]    = { 0 };
+    #endif
+
+#endif
+
+#if ( NVM_CFG_EE_PAGE_BUF_SIZE > 0 )
+
+    /**
+     *  Flash page buffer for sync of pages shared with other data
+     */
+    static uint8_t g_page_buf[NVM_CFG_EE_PAGE_BUF_SIZE] = { 0 };
+
+#endif
+
+/**
+ *  EEPROM emulated regions control
+ */
+static nvm_ee_region_t g_ee_region[eNVM_REGION_NUM_OF] = { 0 };
+
+/**
+ *  Sync job in progress
+ */
+static nvm_ee_sync_job_t g_sync_job = { 0 };
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static nvm_status_t nvm_ee_copy_ram_to_flash    (void);
-static nvm_status_t nvm_ee_copy_flash_to_ram    (void);
+#if ( 1 != NVM_CFG_EE_LAZY_LOAD_EN )
+    static nvm_status_t nvm_ee_copy_flash_to_ram    (void);
+#endif
+static nvm_status_t nvm_ee_load_region          (const nvm_region_name_t region);
+static void         nvm_ee_set_loaded           (const nvm_region_name_t region);
 static uint32_t     nvm_ee_calc_ram_offset      (const nvm_region_name_t region, const uint32_t addr);
+static uint32_t     nvm_ee_calc_dirty_words     (const nvm_region_name_t region);
+static void         nvm_ee_mark_dirty           (const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+static void         nvm_ee_clear_dirty          (const nvm_region_name_t region);
+static nvm_status_t nvm_ee_write_region         (const nvm_region_name_t region);
+static nvm_mem_drv_name_t nvm_ee_get_drv        (const nvm_region_name_t region);
+static uint32_t     nvm_ee_get_flash_addr       (const nvm_region_name_t region);
+static bool         nvm_ee_get_dirty_run        (const nvm_region_name_t region, const uint32_t * const p_bitmap, uint32_t * const p_block, uint32_t * const p_addr, uint32_t * const p_size);
+static nvm_status_t nvm_ee_restore_erased       (const nvm_region_name_t region);
+static nvm_status_t nvm_ee_sync_in_place        (const nvm_region_name_t region);
+static bool         nvm_ee_is_range_dirty       (const uint32_t * const p_bitmap, const uint32_t addr, const uint32_t size);
+static bool         nvm_ee_sync_next_page       (void);
+static nvm_status_t nvm_ee_sync_erase_page      (void);
+static nvm_status_t nvm_ee_sync_program_chunk   (void);
+static void         nvm_ee_restore_dirty        (const nvm_region_name_t region, const uint32_t * const p_mask);
+static nvm_status_t nvm_ee_sync_log             (const nvm_region_name_t region);
+static void         nvm_ee_seq_begin            (const nvm_region_name_t region);
+static void         nvm_ee_seq_end              (const nvm_region_name_t region);
+
+#if ( 1 == NVM_CFG_EE_PROG_ONLY_EN )
+    static bool         nvm_ee_get_prog_run         (const nvm_region_name_t region, const uint32_t * const p_bitmap, const uint32_t from, const uint32_t to, uint32_t * const p_start, uint32_t * const p_end);
+    static bool         nvm_ee_is_prog_only         (const nvm_region_name_t region, const uint32_t * const p_bitmap, const uint32_t from, const uint32_t to);
+    static nvm_status_t nvm_ee_sync_prog_only       (const nvm_region_name_t region);
+    static bool         nvm_ee_sync_start_prog_only (void);
+    static nvm_status_t nvm_ee_sync_program_dirty   (void);
+#endif
+
+#if ( 1 == NVM_CFG_EE_AB_EN )
+    static uint32_t     nvm_ee_ab_calc_footer_size  (const nvm_region_name_t region);
+    static uint32_t     nvm_ee_ab_get_slot_addr     (const nvm_region_name_t region, const uint32_t slot);
+    static uint32_t     nvm_ee_ab_get_word          (const uint8_t * const p_buf);
+    static void         nvm_ee_ab_set_word          (const uint32_t word, uint8_t * const p_buf);
+    static nvm_status_t nvm_ee_ab_select            (const nvm_region_name_t region);
+    static nvm_status_t nvm_ee_ab_sync_step         (void);
+    static bool         nvm_ee_ab_is_busy           (const nvm_region_name_t region);
+#endif
+
+#if ( 1 == NVM_CFG_CRC_EN )
+    static uint32_t     nvm_ee_calc_crc_blocks      (const nvm_region_name_t region);
+    static void         nvm_ee_hash_blocks          (const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+    static uint32_t     nvm_ee_calc_crc             (const nvm_region_name_t region);
+    static void         nvm_ee_update_crc           (const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+#endif
 
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 
+#if ( 1 != NVM_CFG_EE_LAZY_LOAD_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Copy data from FLASH -> RAM
+    *
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_ee_copy_flash_to_ram(void)
+    {
+        nvm_status_t    status                      = eNVM_OK;
+        nvm_vec_t       vec[eNVM_REGION_NUM_OF]     = { 0 };
+        uint32_t        num                         = 0U;
+
+        // Re-write complete RAM space, single multi-range read per memory driver
+        for ( uint32_t drv = 0U; drv < eNVM_MEM_DRV_NUM_OF; drv++ )
+        {
+            num = 0U;
+
+            for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+            {
+                if  (   ( &gp_nvm_drivers[drv] == gp_nvm_regions[region].p_driver )
+                    &&  ( true == gp_nvm_drivers[drv].ee_en ))
+                {
+                    // Log holds all regions of memory driver
+                    if ( NULL != gp_nvm_drivers[drv].p_ee_log )
+                    {
+                        status |= nvm_ee_load_region((nvm_region_name_t) region );
+                    }
+                    else
+                    {
+                        // Find slot holding last commit
+                        #if ( 1 == NVM_CFG_EE_AB_EN )
+                            if ( true == gp_nvm_regions[region].ab_en )
+                            {
+                                status |= nvm_ee_ab_select((nvm_region_name_t) region );
+                            }
+                        #endif
+
+                        vec[num].addr   = nvm_ee_get_flash_addr((nvm_region_name_t) region );
+                        vec[num].size   = gp_nvm_regions[region].size;
+                        vec[num].p_data = &gp_ram_mem[ g_ee_region[region].ram_offset ];
+                        num++;
+                    }
+                }
+            }
+
+            if ( num > 0U )
+            {
+                if ( eNVM_OK != nvm_drv_read_v( &gp_nvm_drivers[drv], (const nvm_vec_t*) &vec, num ))
+                {
+                    status = eNVM_ERROR;
+                }
+                else
+                {
+                    for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+                    {
+                        if ( &gp_nvm_drivers[drv] == gp_nvm_regions[region].p_driver )
+                        {
+                            nvm_ee_set_loaded((nvm_region_name_t) region );
+                        }
+                    }
+                }
+            }
+        }
+
+        return status;
+    }
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Copy data from RAM -> FLASH
+*		Copy single region from FLASH -> RAM
 *
+* @note     Region that is already loaded is left untouched.
+*
+* @param[in]    region  - NVM region name
 * @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static nvm_status_t nvm_ee_copy_ram_to_flash(void)
+static nvm_status_t nvm_ee_load_region(const nvm_region_name_t region)
 {
-    nvm_status_t    status      = eNVM_OK;
-    uint32_t        ram_offset  = 0U;
+    nvm_status_t status = eNVM_OK;
 
-    // Re-write complete RAM space
-    for (uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++)
+    if ( false == g_ee_region[region].loaded )
     {
-        // Check if EEPROM emulation is enabled
-        if ( true == gp_nvm_regions[region].p_driver->ee_en )
+        // Replay log of memory driver
+        if ( NULL != gp_nvm_regions[region].p_driver->p_ee_log )
+        {
+            // Log holds all regions of memory driver
+            for ( uint32_t reg_idx = 0U; reg_idx < eNVM_REGION_NUM_OF; reg_idx++ )
+            {
+                if ( gp_nvm_regions[reg_idx].p_driver == gp_nvm_regions[region].p_driver )
+                {
+                    nvm_ee_seq_begin((nvm_region_name_t) reg_idx );
+                }
+            }
+
+            status = nvm_ee_log_load( nvm_ee_get_drv( region ));
+
+            for ( uint32_t reg_idx = 0U; reg_idx < eNVM_REGION_NUM_OF; reg_idx++ )
+            {
+                if ( gp_nvm_regions[reg_idx].p_driver == gp_nvm_regions[region].p_driver )
+                {
+                    if ( eNVM_OK == status )
+                    {
+                        nvm_ee_set_loaded((nvm_region_name_t) reg_idx );
+                    }
+
+                    nvm_ee_seq_end((nvm_region_name_t) reg_idx );
+                }
+            }
+        }
+
+        // Read complete NVM region
+        else
         {
-            // Write complete NVM region
-            if ( eNVM_OK != gp_nvm_regions[region].p_driver->pf_nvm_write( gp_nvm_regions[region].start_addr, gp_nvm_regions[region].size, (const uint8_t*) &gp_ram_mem[ram_offset] ))
+            // Find slot holding last commit
+            #if ( 1 == NVM_CFG_EE_AB_EN )
+                if ( true == gp_nvm_regions[region].ab_en )
+                {
+                    status = nvm_ee_ab_select( region );
+                }
+            #endif
+
+            nvm_ee_seq_begin( region );
+
+            if  (   ( eNVM_OK != status )
+                ||  ( eNVM_OK != NVM_DEV_READ( gp_nvm_regions[region].p_driver, nvm_ee_get_flash_addr( region ), gp_nvm_regions[region].size, (uint8_t*) &gp_ram_mem[ g_ee_region[region].ram_offset ] )))
             {
                 status = eNVM_ERROR;
             }
+            else
+            {
+                nvm_ee_set_loaded( region );
+            }
 
-            // Increment RAM offset by region size
-            ram_offset = ( ram_offset + gp_nvm_regions[region].size );
+            nvm_ee_seq_end( region );
         }
     }
 
@@ -98,30 +406,330 @@ static nvm_status_t nvm_ee_copy_ram_to_flash(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Copy data from FLASH -> RAM
+*		Mark region as loaded to RAM
+*
+* @note     With integrity trailer enabled for region, block CRCs of
+*           loaded content are calculated and region CRC is checked.
+*
+* @param[in]    region  - NVM region name
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_ee_set_loaded(const nvm_region_name_t region)
+{
+    g_ee_region[region].loaded = true;
+
+    #if ( 1 == NVM_CFG_CRC_EN )
+        if ( true == gp_nvm_regions[region].crc_en )
+        {
+            nvm_ee_hash_blocks( region, 0U, ( gp_nvm_regions[region].size - NVM_CRC_SIZE ));
+
+            g_ee_region[region].crc_ok = ( nvm_ee_calc_crc( region ) == nvm_crc_get( &gp_ram_mem[ nvm_ee_calc_ram_offset( region, gp_nvm_regions[region].size - NVM_CRC_SIZE ) ] ));
+        }
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find local RAM offset that reflects NVM region
+*
+* @note     RAM offsets of regions are calculated once at initialization.
+*
+* @param[in]    region  - NVM region name
+* @param[in]    addr    - Address
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_ee_calc_ram_offset(const nvm_region_name_t region, const uint32_t addr)
+{
+    return ( g_ee_region[region].ram_offset + addr );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate number of dirty bitmap words needed for region
+*
+* @param[in]    region  - NVM region name
+* @return 		words	- Number of 32-bit bitmap words
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_ee_calc_dirty_words(const nvm_region_name_t region)
+{
+    const uint32_t blocks = (( gp_nvm_regions[region].size + NVM_CFG_EE_BLOCK_SIZE - 1U ) / NVM_CFG_EE_BLOCK_SIZE );
+
+    return (( blocks + NVM_EE_DIRTY_WORD_BITS - 1U ) / NVM_EE_DIRTY_WORD_BITS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Mark blocks of region as dirty
+*
+* @param[in]    region  - NVM region name
+* @param[in]    addr    - Start address of modification
+* @param[in]    size    - Number of modified bytes
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_ee_mark_dirty(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+{
+    const uint32_t first_block  = ( addr / NVM_CFG_EE_BLOCK_SIZE );
+    const uint32_t last_block   = (( addr + size - 1U ) / NVM_CFG_EE_BLOCK_SIZE );
+
+    if ( size > 0U )
+    {
+        for ( uint32_t block = first_block; block <= last_block; block++ )
+        {
+            g_ee_region[region].p_dirty[ block / NVM_EE_DIRTY_WORD_BITS ] |= ( 1UL << ( block % NVM_EE_DIRTY_WORD_BITS ));
+        }
+
+        g_ee_region[region].dirty = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Mark all blocks of region as clean
+*
+* @param[in]    region  - NVM region name
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_ee_clear_dirty(const nvm_region_name_t region)
+{
+    memset( g_ee_region[region].p_dirty, 0U, ( nvm_ee_calc_dirty_words( region ) * sizeof( uint32_t )));
+
+    g_ee_region[region].dirty = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Copy complete region from RAM -> FLASH
 *
+* @note     Region inside flash must be erased before calling that function!
+*
+* @param[in]    region  - NVM region name
 * @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static nvm_status_t nvm_ee_copy_flash_to_ram(void)
+static nvm_status_t nvm_ee_write_region(const nvm_region_name_t region)
 {
     nvm_status_t    status      = eNVM_OK;
-    uint32_t        ram_offset  = 0U;
+    const uint32_t  ram_offset  = nvm_ee_calc_ram_offset( region, 0U );
+
+    // Write complete NVM region
+    if ( eNVM_OK != NVM_DEV_WRITE( gp_nvm_regions[region].p_driver, gp_nvm_regions[region].start_addr, gp_nvm_regions[region].size, (const uint8_t*) &gp_ram_mem[ram_offset] ))
+    {
+        status = eNVM_ERROR;
+    }
+    else
+    {
+        // RAM and flash content are now the same
+        nvm_ee_clear_dirty( region );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get memory driver of region
+*
+* @param[in]    region  - NVM region name
+* @return 		drv	    - Memory driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_mem_drv_name_t nvm_ee_get_drv(const nvm_region_name_t region)
+{
+    return (nvm_mem_drv_name_t)( gp_nvm_regions[region].p_driver - gp_nvm_drivers );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get flash address of region content
+*
+* @note     A/B region content is in its active slot.
+*
+* @param[in]    region  - NVM region name
+* @return 		addr    - Flash address of region content
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_ee_get_flash_addr(const nvm_region_name_t region)
+{
+    uint32_t addr = gp_nvm_regions[region].start_addr;
+
+    #if ( 1 == NVM_CFG_EE_AB_EN )
+        if ( true == gp_nvm_regions[region].ab_en )
+        {
+            addr = nvm_ee_ab_get_slot_addr( region, g_ee_region[region].ab_slot );
+        }
+    #endif
+
+    return addr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find next run of consecutive dirty blocks
+*
+* @param[in]    region      - NVM region name
+* @param[in]    p_bitmap    - Dirty blocks bitmap of region
+* @param[in,out]p_block     - Block to start search from. Set to block after run.
+* @param[out]   p_addr      - Start address of run inside region
+* @param[out]   p_size      - Size of run in bytes
+* @return 		found	    - Dirty run found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_ee_get_dirty_run(const nvm_region_name_t region, const uint32_t * const p_bitmap, uint32_t * const p_block, uint32_t * const p_addr, uint32_t * const p_size)
+{
+    const uint32_t  blocks  = (( gp_nvm_regions[region].size + NVM_CFG_EE_BLOCK_SIZE - 1U ) / NVM_CFG_EE_BLOCK_SIZE );
+    const uint32_t* p_dirty = p_bitmap;
+    uint32_t        first   = *p_block;
+    uint32_t        last    = 0U;
+    uint32_t        end     = 0U;
+    bool            found   = false;
+
+    // Find first dirty block
+    while (( first < blocks ) && ( 0U == ( p_dirty[ first / NVM_EE_DIRTY_WORD_BITS ] & ( 1UL << ( first % NVM_EE_DIRTY_WORD_BITS )))))
+    {
+        first++;
+    }
+
+    if ( first < blocks )
+    {
+        // Find end of run
+        last = first;
+
+        while ((( last + 1U ) < blocks ) && ( 0U != ( p_dirty[ ( last + 1U ) / NVM_EE_DIRTY_WORD_BITS ] & ( 1UL << (( last + 1U ) % NVM_EE_DIRTY_WORD_BITS )))))
+        {
+            last++;
+        }
+
+        end = (( last + 1U ) * NVM_CFG_EE_BLOCK_SIZE );
+
+        if ( end > gp_nvm_regions[region].size )
+        {
+            end = gp_nvm_regions[region].size;
+        }
+
+        *p_addr     = ( first * NVM_CFG_EE_BLOCK_SIZE );
+        *p_size     = ( end - *p_addr );
+        *p_block    = ( last + 1U );
+        found       = true;
+    }
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Restore blocks of region wiped by erase of neighbouring region
+*
+* @brief    Each block is compared against RAM. Block is re-written from
+*           RAM when it reads back blank, or when it is clean and some of
+*           its bytes got erased. Both cases program only erased cells
+*           or re-program bytes already equal to RAM, so content of blocks
+*           outside erased range is never altered.
+*
+* @note     Dirty block that was only partly erased is left as is and
+*           stays dirty, so sync of its own region re-writes it.
+*
+* @param[in]    region  - NVM region name
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_ee_restore_erased(const nvm_region_name_t region)
+{
+    nvm_status_t    status                          = eNVM_OK;
+    const uint32_t  blocks                          = (( gp_nvm_regions[region].size + NVM_CFG_EE_BLOCK_SIZE - 1U ) / NVM_CFG_EE_BLOCK_SIZE );
+    uint8_t         buf[NVM_CFG_EE_BLOCK_SIZE]      = { 0 };
+    const uint8_t * p_ram                           = NULL;
+    uint32_t *      p_dirty                         = g_ee_region[region].p_dirty;
+    uint32_t        addr                            = 0U;
+    uint32_t        size                            = 0U;
+    uint32_t        run_addr                        = 0U;
+    uint32_t        run_size                        = 0U;
+    uint32_t        bit                             = 0U;
+    bool            dirty                           = false;
+    bool            blank                           = false;
+    bool            wiped                           = false;
 
-    // Re-write complete RAM space
-    for (uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++)
+    // One pass after last block writes out pending run
+    for ( uint32_t block = 0U; block <= blocks; block++ )
     {
-        // Check if EEPROM emulation is enabled
-        if ( true == gp_nvm_regions[region].p_driver->ee_en )
+        wiped = false;
+
+        if  (   ( block < blocks )
+            &&  ( eNVM_OK == status ))
+        {
+            addr    = ( block * NVM_CFG_EE_BLOCK_SIZE );
+            size    = ( gp_nvm_regions[region].size - addr );
+            size    = (( size > NVM_CFG_EE_BLOCK_SIZE ) ? NVM_CFG_EE_BLOCK_SIZE : size );
+            p_ram   = &gp_ram_mem[ nvm_ee_calc_ram_offset( region, addr ) ];
+            bit     = ( 1UL << ( block % NVM_EE_DIRTY_WORD_BITS ));
+            dirty   = ( 0U != ( p_dirty[ block / NVM_EE_DIRTY_WORD_BITS ] & bit ));
+            blank   = true;
+
+            if ( eNVM_OK != NVM_DEV_READ( gp_nvm_regions[region].p_driver, gp_nvm_regions[region].start_addr + addr, size, (uint8_t*) &buf ))
+            {
+                status = eNVM_ERROR;
+            }
+
+            for ( uint32_t i = 0U; ( i < size ) && ( eNVM_OK == status ); i++ )
+            {
+                if ( 0xFFU != buf[i] )
+                {
+                    blank = false;
+                }
+                else if ( 0xFFU != p_ram[i] )
+                {
+                    wiped = true;
+                }
+                else
+                {
+                    // Erased and expected blank
+                }
+            }
+
+            wiped = (( true == wiped ) && (( true == blank ) || ( false == dirty )));
+        }
+
+        // Extend run of wiped blocks
+        if ( true == wiped )
+        {
+            run_addr = (( 0U == run_size ) ? addr : run_addr );
+            run_size += size;
+
+            // Flash is going to match RAM
+            p_dirty[ block / NVM_EE_DIRTY_WORD_BITS ] &= ~bit;
+        }
+
+        // Re-write run from RAM
+        else if ( run_size > 0U )
         {
-            // Read complete NVM region
-            if ( eNVM_OK != gp_nvm_regions[region].p_driver->pf_nvm_read( gp_nvm_regions[region].start_addr, gp_nvm_regions[region].size, (uint8_t*) &gp_ram_mem[ram_offset] ))
+            if ( eNVM_OK != NVM_DEV_WRITE( gp_nvm_regions[region].p_driver, gp_nvm_regions[region].start_addr + run_addr, run_size, &gp_ram_mem[ nvm_ee_calc_ram_offset( region, run_addr ) ] ))
             {
                 status = eNVM_ERROR;
+
+                // Not restored, sync of region must re-write it
+                nvm_ee_mark_dirty( region, run_addr, run_size );
             }
 
-            // Increment RAM offset by region size
-            ram_offset = ( ram_offset + gp_nvm_regions[region].size );
+            run_size = 0U;
+        }
+        else
+        {
+            // No run pending
+        }
+    }
+
+    // Region stays dirty as long as any of its blocks is
+    g_ee_region[region].dirty = false;
+
+    for ( uint32_t word = 0U; word < nvm_ee_calc_dirty_words( region ); word++ )
+    {
+        if ( 0U != p_dirty[word] )
+        {
+            g_ee_region[region].dirty = true;
         }
     }
 
@@ -130,40 +738,934 @@ static nvm_status_t nvm_ee_copy_flash_to_ram(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Find local RAM offset that reflects NVM region
+*		Sync region to flash in place
+*
+* @brief    Erases region and re-writes it from RAM. Flash geometry is
+*           unknown, so erase might extend over neighbouring regions of the
+*           same memory driver. All of them are loaded to RAM before erase
+*           and afterwards only their blocks wiped by erase are restored.
+*
+* @note     Flash is left untouched if any neighbouring region fails to
+*           load. Dirty blocks of neighbours outside erased range remain
+*           dirty.
 *
 * @param[in]    region  - NVM region name
-* @param[in]    addr    - Address
 * @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static uint32_t nvm_ee_calc_ram_offset(const nvm_region_name_t region, const uint32_t addr)
+static nvm_status_t nvm_ee_sync_in_place(const nvm_region_name_t region)
 {
-    uint32_t ram_offset = addr;
+    nvm_status_t status = eNVM_OK;
+
+    // Neighbouring regions might be wiped by erase, keep them in RAM
+    for ( uint32_t reg_idx = 0U; ( reg_idx < eNVM_REGION_NUM_OF ) && ( eNVM_OK == status ); reg_idx++ )
+    {
+        if ( gp_nvm_regions[reg_idx].p_driver == gp_nvm_regions[region].p_driver )
+        {
+            status = nvm_ee_load_region((nvm_region_name_t) reg_idx );
+        }
+    }
+
+    if ( eNVM_OK == status )
+    {
+        // Erase flash page
+        if ( eNVM_OK != NVM_DEV_ERASE( gp_nvm_regions[region].p_driver, gp_nvm_regions[region].start_addr, gp_nvm_regions[region].size ))
+        {
+            status = eNVM_ERROR;
+        }
+
+        // Copy content from RAM -> FLASH
+        status |= nvm_ee_write_region( region );
+
+        // Restore neighbours, also when region itself failed as erase
+        // might have already wiped them
+        for ( uint32_t reg_idx = 0U; reg_idx < eNVM_REGION_NUM_OF; reg_idx++ )
+        {
+            if  (   ( reg_idx != (uint32_t) region )
+                &&  ( gp_nvm_regions[reg_idx].p_driver == gp_nvm_regions[region].p_driver ))
+            {
+                status |= nvm_ee_restore_erased((nvm_region_name_t) reg_idx );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if any block of region address range is dirty
+*
+* @param[in]    p_bitmap    - Dirty blocks bitmap of region
+* @param[in]    addr        - Start address inside region
+* @param[in]    size        - Size of range in bytes
+* @return 		dirty	    - Range contains dirty block
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_ee_is_range_dirty(const uint32_t * const p_bitmap, const uint32_t addr, const uint32_t size)
+{
+    const uint32_t  first_block = ( addr / NVM_CFG_EE_BLOCK_SIZE );
+    const uint32_t  last_block  = (( addr + size - 1U ) / NVM_CFG_EE_BLOCK_SIZE );
+    bool            dirty       = false;
+
+    for ( uint32_t block = first_block; ( block <= last_block ) && ( false == dirty ); block++ )
+    {
+        dirty = ( 0U != ( p_bitmap[ block / NVM_EE_DIRTY_WORD_BITS ] & ( 1UL << ( block % NVM_EE_DIRTY_WORD_BITS ))));
+    }
+
+    return dirty;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find next flash page of sync job holding dirty blocks
+*
+* @brief    Search starts at current page of sync job. Pages without dirty
+*           blocks of region are skipped.
+*
+* @return 		found	- Dirty page found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_ee_sync_next_page(void)
+{
+    const nvm_region_name_t region      = g_sync_job.region;
+    const uint32_t          page_size   = gp_nvm_regions[region].p_driver->page_size;
+    const uint32_t          reg_start   = gp_nvm_regions[region].start_addr;
+    const uint32_t          reg_end     = ( reg_start + gp_nvm_regions[region].size );
+    uint32_t                part_start  = 0U;
+    uint32_t                part_end    = 0U;
+    bool                    found       = false;
+
+    for ( ; ( g_sync_job.page_addr < reg_end ) && ( false == found ); )
+    {
+        part_start  = ( reg_start > g_sync_job.page_addr ) ? reg_start : g_sync_job.page_addr;
+        part_end    = ( reg_end < ( g_sync_job.page_addr + page_size )) ? reg_end : ( g_sync_job.page_addr + page_size );
+        found       = nvm_ee_is_range_dirty( gp_sync_mask, ( part_start - reg_start ), ( part_end - part_start ));
+
+        if ( false == found )
+        {
+            g_sync_job.page_addr += page_size;
+        }
+    }
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase flash page of sync job
+*
+* @brief    Page that is completely covered by region is later programmed
+*           directly from RAM. Page shared with other data is first read
+*           into page buffer and updated with region content, so bytes
+*           outside of region are kept intact.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_ee_sync_erase_page(void)
+{
+    nvm_status_t                    status      = eNVM_OK;
+    const nvm_region_name_t         region      = g_sync_job.region;
+    const nvm_mem_driver_t * const  p_drv       = gp_nvm_regions[region].p_driver;
+    const uint32_t                  page_addr   = g_sync_job.page_addr;
+    const uint32_t                  reg_start   = gp_nvm_regions[region].start_addr;
+    const uint32_t                  reg_end     = ( reg_start + gp_nvm_regions[region].size );
+    const uint32_t                  part_start  = ( reg_start > page_addr ) ? reg_start : page_addr;
+    const uint32_t                  part_end    = ( reg_end < ( page_addr + p_drv->page_size )) ? reg_end : ( page_addr + p_drv->page_size );
+    const uint32_t                  offset      = ( part_start - reg_start );
+    const uint32_t                  part_size   = ( part_end - part_start );
+
+    // Complete page belongs to region
+    if ( part_size == p_drv->page_size )
+    {
+        g_sync_job.p_src = &gp_ram_mem[ nvm_ee_calc_ram_offset( region, offset ) ];
+    }
+
+    // Page shared with other data
+    else
+    {
+        #if ( NVM_CFG_EE_PAGE_BUF_SIZE > 0 )
+
+            NVM_ASSERT( p_drv->page_size <= NVM_CFG_EE_PAGE_BUF_SIZE );
+
+            if  (   ( p_drv->page_size > NVM_CFG_EE_PAGE_BUF_SIZE )
+                ||  ( eNVM_OK != NVM_DEV_READ( p_drv, page_addr, p_drv->page_size, (uint8_t*) &g_page_buf )))
+            {
+                status = eNVM_ERROR;
+            }
+            else
+            {
+                memcpy( &g_page_buf[ part_start - page_addr ], &gp_ram_mem[ nvm_ee_calc_ram_offset( region, offset ) ], part_size );
+
+                g_sync_job.p_src = (const uint8_t*) &g_page_buf;
+            }
+
+        #else
+            status = eNVM_ERROR;
+        #endif
+    }
+
+    if ( eNVM_OK == status )
+    {
+        if ( eNVM_OK != NVM_DEV_ERASE( p_drv, page_addr, p_drv->page_size ))
+        {
+            status = eNVM_ERROR;
+        }
+        else
+        {
+            g_sync_job.prog_addr    = page_addr;
+            g_sync_job.erased       = true;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program next chunk of erased flash page of sync job
+*
+* @note     Chunk size is NVM_CFG_EE_SYNC_CHUNK_SIZE, or complete page if
+*           chunk size is 0.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_ee_sync_program_chunk(void)
+{
+    nvm_status_t                    status      = eNVM_OK;
+    const nvm_mem_driver_t * const  p_drv       = gp_nvm_regions[g_sync_job.region].p_driver;
+    const uint32_t                  page_end    = ( g_sync_job.page_addr + p_drv->page_size );
+    uint32_t                        chunk       = ( page_end - g_sync_job.prog_addr );
+
+    #if ( NVM_CFG_EE_SYNC_CHUNK_SIZE > 0 )
+        if ( chunk > NVM_CFG_EE_SYNC_CHUNK_SIZE )
+        {
+            chunk = NVM_CFG_EE_SYNC_CHUNK_SIZE;
+        }
+    #endif
+
+    if ( eNVM_OK != NVM_DEV_WRITE( p_drv, g_sync_job.prog_addr, chunk, &g_sync_job.p_src[ g_sync_job.prog_addr - g_sync_job.page_addr ] ))
+    {
+        status = eNVM_ERROR;
+    }
+    else
+    {
+        g_sync_job.prog_addr += chunk;
+
+        // Page completed
+        if ( g_sync_job.prog_addr >= page_end )
+        {
+            g_sync_job.page_addr    = page_end;
+            g_sync_job.erased       = false;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Mark blocks of failed sync as dirty again
+*
+* @param[in]    region  - NVM region name
+* @param[in]    p_mask  - Dirty blocks of region that were being synced
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_ee_restore_dirty(const nvm_region_name_t region, const uint32_t * const p_mask)
+{
+    for ( uint32_t word = 0U; word < nvm_ee_calc_dirty_words( region ); word++ )
+    {
+        g_ee_region[region].p_dirty[word] |= p_mask[word];
+    }
+
+    g_ee_region[region].dirty = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Begin modification of region RAM content
+*
+* @note     Has effect only with NVM_CFG_EE_SEQLOCK_EN. Writers must be
+*           serialized by NVM lock.
+*
+* @param[in]    region  - NVM region name
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_ee_seq_begin(const nvm_region_name_t region)
+{
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        atomic_fetch_add_explicit( &g_ee_region[region].seq, 1U, memory_order_relaxed );
+        atomic_thread_fence( memory_order_release );
+    #else
+        (void) region;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		End modification of region RAM content
+*
+* @param[in]    region  - NVM region name
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_ee_seq_end(const nvm_region_name_t region)
+{
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        atomic_fetch_add_explicit( &g_ee_region[region].seq, 1U, memory_order_release );
+    #else
+        (void) region;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sync region to flash log
+*
+* @brief    Dirty runs of region are appended to log as records. If active
+*           log page does not have enough space, log is compacted into next
+*           page, which stores all driver regions.
+*
+* @param[in]    region  - NVM region name
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_ee_sync_log(const nvm_region_name_t region)
+{
+    nvm_status_t                status      = eNVM_OK;
+    const nvm_mem_drv_name_t    drv         = nvm_ee_get_drv( region );
+    uint32_t                    required    = 0U;
+    uint32_t                    block       = 0U;
+    uint32_t                    addr        = 0U;
+    uint32_t                    size        = 0U;
+
+    // Space needed for all dirty runs
+    while ( true == nvm_ee_get_dirty_run( region, g_ee_region[region].p_dirty, &block, &addr, &size ))
+    {
+        required += nvm_ee_log_calc_record_size( size );
+    }
+
+    // Append changes
+    if ( required <= nvm_ee_log_get_free( drv ))
+    {
+        block = 0U;
+
+        while   (   ( eNVM_OK == status )
+                &&  ( true == nvm_ee_get_dirty_run( region, g_ee_region[region].p_dirty, &block, &addr, &size )))
+        {
+            status = nvm_ee_log_append( drv, gp_nvm_regions[region].start_addr + addr, size, &gp_ram_mem[ nvm_ee_calc_ram_offset( region, addr ) ] );
+        }
+
+        if ( eNVM_OK == status )
+        {
+            nvm_ee_clear_dirty( region );
+        }
+    }
+
+    // Compact log with all driver regions
+    else
+    {
+        status = nvm_ee_log_compact( drv );
+
+        if ( eNVM_OK == status )
+        {
+            for ( uint32_t reg_idx = 0U; reg_idx < eNVM_REGION_NUM_OF; reg_idx++ )
+            {
+                if ( gp_nvm_regions[reg_idx].p_driver == gp_nvm_regions[region].p_driver )
+                {
+                    nvm_ee_clear_dirty((nvm_region_name_t) reg_idx );
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+#if ( 1 == NVM_CFG_EE_AB_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Calculate size of A/B slot footer
+    *
+    * @note     Footer takes whole programming units of memory driver.
+    *
+    * @param[in]    region  - NVM region name
+    * @return 		size    - Size of footer in bytes
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t nvm_ee_ab_calc_footer_size(const nvm_region_name_t region)
+    {
+        const uint32_t prog_size = ( 0U != gp_nvm_regions[region].p_driver->prog_size ) ? gp_nvm_regions[region].p_driver->prog_size : 1U;
+
+        return ((( NVM_AB_FOOTER_SIZE + prog_size - 1U ) / prog_size ) * prog_size );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get start address of A/B slot
+    *
+    * @param[in]    region  - NVM region name
+    * @param[in]    slot    - Slot, 0 for A and 1 for B
+    * @return 		addr    - Flash address of slot
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t nvm_ee_ab_get_slot_addr(const nvm_region_name_t region, const uint32_t slot)
+    {
+        return ( gp_nvm_regions[region].start_addr + ( slot * nvm_ee_ab_calc_slot_size( &gp_nvm_regions[region] )));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Get word of A/B slot footer
+    *
+    * @param[in]    p_buf   - Footer field, 4 bytes little endian
+    * @return 		word    - Footer word
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t nvm_ee_ab_get_word(const uint8_t * const p_buf)
+    {
+        return  (   (uint32_t) p_buf[0]
+                |   ((uint32_t) p_buf[1] << 8U )
+                |   ((uint32_t) p_buf[2] << 16U )
+                |   ((uint32_t) p_buf[3] << 24U ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Set word of A/B slot footer
+    *
+    * @param[in]    word    - Footer word
+    * @param[out]   p_buf   - Footer field, 4 bytes little endian
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_ee_ab_set_word(const uint32_t word, uint8_t * const p_buf)
+    {
+        p_buf[0] = (uint8_t)( word );
+        p_buf[1] = (uint8_t)( word >> 8U );
+        p_buf[2] = (uint8_t)( word >> 16U );
+        p_buf[3] = (uint8_t)( word >> 24U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Select active slot of A/B region
+    *
+    * @brief    Footer of valid slot holds sequence number followed by its
+    *           complement. Erased or partially programmed footer fails that
+    *           check. Valid slot with newest sequence number is active.
+    *
+    * @note     Without valid slot region is loaded from slot A, so content
+    *           of region switched from in-place to A/B mode is kept until
+    *           first commit into slot B.
+    *
+    * @param[in]    region  - NVM region name
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_ee_ab_select(const nvm_region_name_t region)
+    {
+        nvm_status_t                    status                          = eNVM_OK;
+        const nvm_mem_driver_t * const  p_drv                           = gp_nvm_regions[region].p_driver;
+        const uint32_t                  footer_offset                   = ( nvm_ee_ab_calc_slot_size( &gp_nvm_regions[region] ) - nvm_ee_ab_calc_footer_size( region ));
+        uint8_t                         footer[NVM_AB_FOOTER_SIZE]      = { 0 };
+        uint32_t                        seq                             = 0U;
+        bool                            found                           = false;
+
+        g_ee_region[region].ab_slot     = 0U;
+        g_ee_region[region].ab_seq      = 0U;
+        g_ee_region[region].ab_erased   = false;
+
+        for ( uint32_t slot = 0U; ( slot < NVM_EE_AB_SLOT_NUM ) && ( eNVM_OK == status ); slot++ )
+        {
+            if ( eNVM_OK != NVM_DEV_READ( p_drv, nvm_ee_ab_get_slot_addr( region, slot ) + footer_offset, NVM_AB_FOOTER_SIZE, (uint8_t*) &footer ))
+            {
+                status = eNVM_ERROR;
+            }
+            else
+            {
+                seq = nvm_ee_ab_get_word( &footer[0] );
+
+                // Newer valid slot, sequence number may wrap around
+                if  (   ( ~seq == nvm_ee_ab_get_word( &footer[4] ))
+                    &&  (   ( false == found )
+                        ||  ((int32_t)( seq - g_ee_region[region].ab_seq ) > 0 )))
+                {
+                    g_ee_region[region].ab_slot = slot;
+                    g_ee_region[region].ab_seq  = seq;
+                    found = true;
+                }
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Execute single step of A/B region sync job
+    *
+    * @brief    Inactive slot is erased page by page (skipped if already
+    *           erased), then programmed with RAM content chunk by chunk and
+    *           finally committed by programming its footer with next
+    *           sequence number. Previously active slot stays valid until
+    *           commit, therefore power loss at any step keeps one of both
+    *           contents.
+    *
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_ee_ab_sync_step(void)
+    {
+        nvm_status_t                    status                          = eNVM_OK;
+        const nvm_region_name_t         region                          = g_sync_job.region;
+        const nvm_mem_driver_t * const  p_drv                           = gp_nvm_regions[region].p_driver;
+        const uint32_t                  slot_addr                       = nvm_ee_ab_get_slot_addr( region, ( 1U - g_ee_region[region].ab_slot ));
+        const uint32_t                  slot_end                        = ( slot_addr + nvm_ee_ab_calc_slot_size( &gp_nvm_regions[region] ));
+        const uint32_t                  data_end                        = ( slot_addr + gp_nvm_regions[region].size );
+        const uint32_t                  footer_size                     = nvm_ee_ab_calc_footer_size( region );
+        uint8_t                         footer[NVM_AB_FOOTER_MAX_SIZE]  = { 0 };
+        uint32_t                        chunk                           = 0U;
+
+        // Erase inactive slot
+        if ( false == g_sync_job.erased )
+        {
+            if ( eNVM_OK != NVM_DEV_ERASE( p_drv, g_sync_job.page_addr, p_drv->page_size ))
+            {
+                status = eNVM_ERROR;
+            }
+            else
+            {
+                g_sync_job.page_addr += p_drv->page_size;
+                g_sync_job.erased = ( g_sync_job.page_addr >= slot_end );
+            }
+        }
+
+        // Program region content
+        else if ( g_sync_job.prog_addr < data_end )
+        {
+            chunk = ( data_end - g_sync_job.prog_addr );
+
+            #if ( NVM_CFG_EE_SYNC_CHUNK_SIZE > 0 )
+                if ( chunk > NVM_CFG_EE_SYNC_CHUNK_SIZE )
+                {
+                    chunk = NVM_CFG_EE_SYNC_CHUNK_SIZE;
+                }
+            #endif
+
+            if ( eNVM_OK != NVM_DEV_WRITE( p_drv, g_sync_job.prog_addr, chunk, &gp_ram_mem[ nvm_ee_calc_ram_offset( region, ( g_sync_job.prog_addr - slot_addr )) ] ))
+            {
+                status = eNVM_ERROR;
+            }
+            else
+            {
+                g_sync_job.prog_addr += chunk;
+            }
+        }
+
+        // Commit slot
+        else
+        {
+            memset( &footer, 0xFF, sizeof( footer ));
+            nvm_ee_ab_set_word(( g_ee_region[region].ab_seq + 1U ), &footer[0] );
+            nvm_ee_ab_set_word( ~( g_ee_region[region].ab_seq + 1U ), &footer[4] );
+
+            if ( eNVM_OK != NVM_DEV_WRITE( p_drv, ( slot_end - footer_size ), footer_size, (const uint8_t*) &footer ))
+            {
+                status = eNVM_ERROR;
+            }
+            else
+            {
+                g_ee_region[region].ab_slot = ( 1U - g_ee_region[region].ab_slot );
+                g_ee_region[region].ab_seq++;
+                g_sync_job.active = false;
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check if commit of A/B region is in progress
+    *
+    * @note     Slot is programmed directly from RAM, so region content must
+    *           not change until footer is written. Otherwise committed slot
+    *           would mix content before and after modification.
+    *
+    * @note     Caller must hold memory driver lock of region, same as sync
+    *           job while it changes the flag.
+    *
+    * @param[in]    region  - NVM region name
+    * @return 		busy    - Commit of region is in progress
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_ee_ab_is_busy(const nvm_region_name_t region)
+    {
+        return g_ee_region[region].ab_busy;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_CRC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Calculate number of CRC blocks of region
+    *
+    * @param[in]    region  - NVM region name
+    * @return 		num     - Number of CRC blocks, 0 without integrity trailer
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t nvm_ee_calc_crc_blocks(const nvm_region_name_t region)
+    {
+        uint32_t num = 0U;
+
+        if ( true == gp_nvm_regions[region].crc_en )
+        {
+            num = ((( gp_nvm_regions[region].size - NVM_CRC_SIZE ) + NVM_CFG_CRC_BLOCK_SIZE - 1U ) / NVM_CFG_CRC_BLOCK_SIZE );
+        }
+
+        return num;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Recalculate CRCs of blocks touched by address range
+    *
+    * @note     Part of range inside integrity trailer is ignored.
+    *
+    * @param[in]    region  - NVM region name
+    * @param[in]    addr    - Start address relative to region
+    * @param[in]    size    - Size of range in bytes
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_ee_hash_blocks(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+    {
+        const uint32_t  data_size   = ( gp_nvm_regions[region].size - NVM_CRC_SIZE );
+        uint32_t        end         = ( addr + size );
+        uint32_t        block_size  = 0U;
+
+        if ( end > data_size )
+        {
+            end = data_size;
+        }
+
+        for ( uint32_t block = ( addr / NVM_CFG_CRC_BLOCK_SIZE ); ( block * NVM_CFG_CRC_BLOCK_SIZE ) < end; block++ )
+        {
+            // Last block may be shorter
+            block_size = ( data_size - ( block * NVM_CFG_CRC_BLOCK_SIZE ));
+
+            if ( block_size > NVM_CFG_CRC_BLOCK_SIZE )
+            {
+                block_size = NVM_CFG_CRC_BLOCK_SIZE;
+            }
+
+            g_ee_region[region].p_crc[block] = nvm_crc32( 0U, &gp_ram_mem[ nvm_ee_calc_ram_offset( region, ( block * NVM_CFG_CRC_BLOCK_SIZE )) ], block_size );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Calculate CRC of region data in RAM
+    *
+    * @note     Calculated from block CRCs, data itself is not read.
+    *
+    * @param[in]    region  - NVM region name
+    * @return 		crc	    - CRC of region data (without trailer)
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t nvm_ee_calc_crc(const nvm_region_name_t region)
+    {
+        uint32_t crc = 0U;
+
+        for ( uint32_t block = 0U; block < nvm_ee_calc_crc_blocks( region ); block++ )
+        {
+            crc = nvm_crc_add_block( crc, g_ee_region[region].p_crc[block] );
+        }
+
+        return crc;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Update integrity trailer of region in RAM after modification
+    *
+    * @note     Only blocks touched by modification are rehashed. Trailer
+    *           block is marked dirty only if CRC changed.
+    *
+    * @note     Must be called inside sequence section of region.
+    *
+    * @param[in]    region  - NVM region name
+    * @param[in]    addr    - Start address of modification relative to region
+    * @param[in]    size    - Size of modification in bytes
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void nvm_ee_update_crc(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+    {
+        const uint32_t  trailer_addr    = ( gp_nvm_regions[region].size - NVM_CRC_SIZE );
+        uint8_t * const p_trailer       = &gp_ram_mem[ nvm_ee_calc_ram_offset( region, trailer_addr ) ];
+        uint32_t        crc             = 0U;
+
+        nvm_ee_hash_blocks( region, addr, size );
+
+        crc = nvm_ee_calc_crc( region );
+
+        if ( crc != nvm_crc_get( p_trailer ))
+        {
+            nvm_crc_set( crc, p_trailer );
+            nvm_ee_mark_dirty( region, trailer_addr, NVM_CRC_SIZE );
+        }
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_EE_PROG_ONLY_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Find next dirty run and align it to programming unit
+    *
+    * @param[in]    region      - NVM region name
+    * @param[in]    p_bitmap    - Dirty blocks bitmap of region
+    * @param[in]    from        - Start of search, offset inside region
+    * @param[in]    to          - End of search (exclusive), offset inside region
+    * @param[out]   p_start     - Start of run, device address aligned to prog_size
+    * @param[out]   p_end       - End of run (exclusive), device address aligned to prog_size
+    * @return 		found	    - Dirty run found
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_ee_get_prog_run(const nvm_region_name_t region, const uint32_t * const p_bitmap, const uint32_t from, const uint32_t to, uint32_t * const p_start, uint32_t * const p_end)
+    {
+        const uint32_t  reg_start   = gp_nvm_regions[region].start_addr;
+        const uint32_t  prog_size   = ( 0U == gp_nvm_regions[region].p_driver->prog_size ) ? 1U : gp_nvm_regions[region].p_driver->prog_size;
+        uint32_t        block       = ( from / NVM_CFG_EE_BLOCK_SIZE );
+        uint32_t        addr        = 0U;
+        uint32_t        size        = 0U;
+        bool            found       = false;
+
+        if  (   ( from < to )
+            &&  ( true == nvm_ee_get_dirty_run( region, p_bitmap, &block, &addr, &size ))
+            &&  ( addr < to ))
+        {
+            // Clip run to search range
+            if ( addr < from )
+            {
+                size -= ( from - addr );
+                addr = from;
+            }
+
+            if (( addr + size ) > to )
+            {
+                size = ( to - addr );
+            }
+
+            *p_start    = ((( reg_start + addr ) / prog_size ) * prog_size );
+            *p_end      = ((( reg_start + addr + size + prog_size - 1U ) / prog_size ) * prog_size );
+            found       = true;
+        }
+
+        return found;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Check if dirty blocks can be programmed without erase
+    *
+    * @brief    Flash content of dirty blocks is read back and compared with
+    *           RAM. Program without erase is possible only if every changed
+    *           bit goes from 1 to 0 and aligned dirty runs do not reach
+    *           outside of region.
+    *
+    * @param[in]    region      - NVM region name
+    * @param[in]    p_bitmap    - Dirty blocks bitmap of region
+    * @param[in]    from        - Start of range, offset inside region
+    * @param[in]    to          - End of range (exclusive), offset inside region
+    * @return 		prog_only	- Dirty blocks can be programmed without erase
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_ee_is_prog_only(const nvm_region_name_t region, const uint32_t * const p_bitmap, const uint32_t from, const uint32_t to)
+    {
+        const nvm_mem_driver_t * const  p_drv                           = gp_nvm_regions[region].p_driver;
+        const uint32_t                  reg_start                       = gp_nvm_regions[region].start_addr;
+        const uint32_t                  reg_end                         = ( reg_start + gp_nvm_regions[region].size );
+        uint8_t                         buf[NVM_EE_PROG_CHECK_BUF_SIZE] = { 0 };
+        const uint8_t *                 p_ram                           = NULL;
+        bool                            prog_only                       = p_drv->prog_only_en;
+        uint32_t                        offset                          = from;
+        uint32_t                        start                           = 0U;
+        uint32_t                        end                             = 0U;
+        uint32_t                        chunk                           = 0U;
+
+        while   (   ( true == prog_only )
+                &&  ( true == nvm_ee_get_prog_run( region, p_bitmap, offset, to, &start, &end )))
+        {
+            // Programming unit shared with other data
+            prog_only = (( start >= reg_start ) && ( end <= reg_end ));
+
+            for ( uint32_t addr = start; ( true == prog_only ) && ( addr < end ); addr += chunk )
+            {
+                chunk = (( end - addr ) < NVM_EE_PROG_CHECK_BUF_SIZE ) ? ( end - addr ) : NVM_EE_PROG_CHECK_BUF_SIZE;
+                p_ram = &gp_ram_mem[ nvm_ee_calc_ram_offset( region, addr - reg_start ) ];
+
+                if ( eNVM_OK != NVM_DEV_READ( p_drv, addr, chunk, (uint8_t*) &buf ))
+                {
+                    prog_only = false;
+                }
+                else
+                {
+                    // Bits can only be cleared
+                    for ( uint32_t i = 0U; ( i < chunk ) && ( true == prog_only ); i++ )
+                    {
+                        prog_only = (( buf[i] & p_ram[i] ) == p_ram[i] );
+                    }
+                }
+            }
+
+            offset = ( end - reg_start );
+        }
+
+        return prog_only;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Program dirty blocks of region without erase
+    *
+    * @note     Used for in-place EEPROM emulation with unknown flash geometry.
+    *           Caller must check for nvm_ee_is_prog_only() first!
+    *
+    * @param[in]    region  - NVM region name
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_ee_sync_prog_only(const nvm_region_name_t region)
+    {
+        nvm_status_t    status      = eNVM_OK;
+        const uint32_t  reg_start   = gp_nvm_regions[region].start_addr;
+        uint32_t        offset      = 0U;
+        uint32_t        start       = 0U;
+        uint32_t        end         = 0U;
+
+        while   (   ( eNVM_OK == status )
+                &&  ( true == nvm_ee_get_prog_run( region, g_ee_region[region].p_dirty, offset, gp_nvm_regions[region].size, &start, &end )))
+        {
+            if ( eNVM_OK != NVM_DEV_WRITE( gp_nvm_regions[region].p_driver, start, ( end - start ), &gp_ram_mem[ nvm_ee_calc_ram_offset( region, start - reg_start ) ] ))
+            {
+                status = eNVM_ERROR;
+            }
+
+            offset = ( end - reg_start );
+        }
+
+        if ( eNVM_OK == status )
+        {
+            nvm_ee_clear_dirty( region );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Prepare program-only sync of flash page of sync job
+    *
+    * @brief    If dirty blocks of region inside page only clear bits, page
+    *           is marked for programming of dirty blocks without erase.
+    *
+    * @return 		prog_only	- Page will be programmed without erase
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool nvm_ee_sync_start_prog_only(void)
+    {
+        const nvm_region_name_t region      = g_sync_job.region;
+        const uint32_t          page_addr   = g_sync_job.page_addr;
+        const uint32_t          page_size   = gp_nvm_regions[region].p_driver->page_size;
+        const uint32_t          reg_start   = gp_nvm_regions[region].start_addr;
+        const uint32_t          reg_end     = ( reg_start + gp_nvm_regions[region].size );
+        const uint32_t          part_start  = ( reg_start > page_addr ) ? reg_start : page_addr;
+        const uint32_t          part_end    = ( reg_end < ( page_addr + page_size )) ? reg_end : ( page_addr + page_size );
+        bool                    prog_only   = false;
+
+        if ( true == nvm_ee_is_prog_only( region, gp_sync_mask, ( part_start - reg_start ), ( part_end - reg_start )))
+        {
+            g_sync_job.prog_addr    = part_start;
+            g_sync_job.erased       = true;
+            g_sync_job.prog_only    = true;
+            prog_only               = true;
+        }
+
+        return prog_only;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Program next dirty run of flash page of sync job without erase
+    *
+    * @note     Run is limited to NVM_CFG_EE_SYNC_CHUNK_SIZE, if non-zero.
+    *
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static nvm_status_t nvm_ee_sync_program_dirty(void)
+    {
+        nvm_status_t                    status      = eNVM_OK;
+        const nvm_region_name_t         region      = g_sync_job.region;
+        const nvm_mem_driver_t * const  p_drv       = gp_nvm_regions[region].p_driver;
+        const uint32_t                  reg_start   = gp_nvm_regions[region].start_addr;
+        const uint32_t                  reg_end     = ( reg_start + gp_nvm_regions[region].size );
+        const uint32_t                  page_end    = ( g_sync_job.page_addr + p_drv->page_size );
+        const uint32_t                  part_end    = ( reg_end < page_end ) ? reg_end : page_end;
+        uint32_t                        start       = 0U;
+        uint32_t                        end         = 0U;
+
+        if ( true == nvm_ee_get_prog_run( region, gp_sync_mask, ( g_sync_job.prog_addr - reg_start ), ( part_end - reg_start ), &start, &end ))
+        {
+            #if ( NVM_CFG_EE_SYNC_CHUNK_SIZE > 0 )
+                if (( end - start ) > NVM_CFG_EE_SYNC_CHUNK_SIZE )
+                {
+                    end = ( start + NVM_CFG_EE_SYNC_CHUNK_SIZE );
+                }
+            #endif
+
+            // Written again since check of page, RAM might set bits - fall back to erase
+            if ( true == nvm_ee_is_range_dirty( g_ee_region[region].p_dirty, ( start - reg_start ), ( end - start )))
+            {
+                g_sync_job.prog_only = false;
 
-    // Go thru all eeprom emulation regions
-    for (uint32_t reg_name = 0U; reg_name < eNVM_REGION_NUM_OF; reg_name++)
-    {
-        // Is eeprom emulated?
-        if ( true == gp_nvm_regions[region].p_driver->ee_en )
-        {
-            // Ignore first region
-            if ( reg_name > 0U )
+                status = nvm_ee_sync_erase_page();
+            }
+            else if ( eNVM_OK != NVM_DEV_WRITE( p_drv, start, ( end - start ), &gp_ram_mem[ nvm_ee_calc_ram_offset( region, start - reg_start ) ] ))
             {
-                // Offset RAM for previous region size
-                ram_offset += gp_nvm_regions[( region - 1U )].size;
+                status = eNVM_ERROR;
             }
-
-            // Maching region
-            if ( region == reg_name )
+            else
             {
-                break;
+                g_sync_job.prog_addr = end;
             }
         }
-    }    
 
-    return ram_offset;
-}
+        // Page completed
+        if  (   ( eNVM_OK == status )
+            &&  ( true == g_sync_job.prog_only )
+            &&  ( false == nvm_ee_get_prog_run( region, gp_sync_mask, ( g_sync_job.prog_addr - reg_start ), ( part_end - reg_start ), &start, &end )))
+        {
+            g_sync_job.page_addr    = page_end;
+            g_sync_job.erased       = false;
+            g_sync_job.prog_only    = false;
+        }
+
+        return status;
+    }
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -187,6 +1689,10 @@ static uint32_t nvm_ee_calc_ram_offset(const nvm_region_name_t region, const uin
 * @brief    This function create space in RAM for inter-mediate EEPROM emulation
 *           purposes.
 *
+* @note     With NVM_CFG_EE_STATIC_RAM_EN space is taken from statically
+*           allocated buffer of NVM_CFG_EE_RAM_SIZE bytes, otherwise it is
+*           allocated from heap.
+*
 * @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
@@ -194,6 +1700,12 @@ nvm_status_t nvm_ee_init(void)
 {
     nvm_status_t    status      = eNVM_OK;
     uint32_t        ram_space   = 0U;
+    uint32_t        dirty_words = 0U;
+    uint32_t        mask_words  = 0U;
+
+    #if ( 1 == NVM_CFG_CRC_EN )
+        uint32_t    crc_blocks  = 0U;
+    #endif
 
     if ( false == gb_is_init )
     {
@@ -212,23 +1724,112 @@ nvm_status_t nvm_ee_init(void)
             {
                 // Accumulate all RAM space needed to contain Flash memory
                 ram_space += gp_nvm_regions[region].size;
+
+                // Accumulate space for dirty blocks bitmaps
+                dirty_words += nvm_ee_calc_dirty_words((nvm_region_name_t) region );
+
+                // Sync mask must fit largest region
+                if ( nvm_ee_calc_dirty_words((nvm_region_name_t) region ) > mask_words )
+                {
+                    mask_words = nvm_ee_calc_dirty_words((nvm_region_name_t) region );
+                }
+
+                // Accumulate space for block CRCs
+                #if ( 1 == NVM_CFG_CRC_EN )
+                    crc_blocks += nvm_ee_calc_crc_blocks((nvm_region_name_t) region );
+                #endif
             }
         }
 
         // Is EEPROM emulation in use?
         if ( ram_space > 0U )
         {
-            gp_ram_mem = malloc( ram_space );
+            #if ( 1 == NVM_CFG_EE_STATIC_RAM_EN )
+
+                NVM_ASSERT( ram_space <= NVM_CFG_EE_RAM_SIZE );
+                NVM_ASSERT( dirty_words <= NVM_EE_DIRTY_WORDS_MAX );
+
+                // Static space must fit all emulated regions
+                if  (   ( ram_space <= NVM_CFG_EE_RAM_SIZE )
+                    &&  ( dirty_words <= NVM_EE_DIRTY_WORDS_MAX ))
+                {
+                    gp_ram_mem      = (uint8_t*) &g_ram_mem;
+                    gp_dirty_mem    = (uint32_t*) &g_dirty_mem;
+                    gp_sync_mask    = (uint32_t*) &g_sync_mask;
+
+                    #if ( 1 == NVM_CFG_CRC_EN )
+                        NVM_ASSERT( crc_blocks <= NVM_EE_CRC_BLOCKS_MAX );
+
+                        if ( crc_blocks <= NVM_EE_CRC_BLOCKS_MAX )
+                        {
+                            gp_crc_mem = (uint32_t*) &g_crc_mem;
+                        }
+                    #endif
+                }
+            #else
+                gp_ram_mem      = malloc( ram_space );
+                gp_dirty_mem    = calloc( dirty_words, sizeof( uint32_t ));
+                gp_sync_mask    = calloc( mask_words, sizeof( uint32_t ));
+
+                #if ( 1 == NVM_CFG_CRC_EN )
+                    if ( crc_blocks > 0U )
+                    {
+                        gp_crc_mem = calloc( crc_blocks, sizeof( uint32_t ));
+                    }
+                #endif
+            #endif
 
             // Allocation success?
-            if ( NULL == gp_ram_mem )
+            if  (   ( NULL == gp_ram_mem )
+                ||  ( NULL == gp_dirty_mem )
+                ||  ( NULL == gp_sync_mask )
+                #if ( 1 == NVM_CFG_CRC_EN )
+                ||  (( crc_blocks > 0U ) && ( NULL == gp_crc_mem ))
+                #endif
+                )
             {
                 status = eNVM_ERROR;
             }
             else
             {
+                // Check log-structured EEPROM emulation
+                status = nvm_ee_log_init();
+
+                // Assign RAM space and dirty bitmaps to regions
+                ram_space   = 0U;
+                dirty_words = 0U;
+
+                #if ( 1 == NVM_CFG_CRC_EN )
+                    crc_blocks = 0U;
+                #endif
+
+                for (uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++)
+                {
+                    if ( true == gp_nvm_regions[region].p_driver->ee_en )
+                    {
+                        g_ee_region[region].ram_offset  = ram_space;
+                        g_ee_region[region].p_dirty     = &gp_dirty_mem[dirty_words];
+                        g_ee_region[region].dirty       = false;
+                        g_ee_region[region].loaded      = false;
+
+                        ram_space   += gp_nvm_regions[region].size;
+                        dirty_words += nvm_ee_calc_dirty_words((nvm_region_name_t) region );
+
+                        #if ( 1 == NVM_CFG_CRC_EN )
+                            if ( true == gp_nvm_regions[region].crc_en )
+                            {
+                                g_ee_region[region].p_crc = &gp_crc_mem[crc_blocks];
+                                crc_blocks += nvm_ee_calc_crc_blocks((nvm_region_name_t) region );
+                            }
+                        #endif
+                    }
+                }
+
                 // Copy all content from Flash to RAM
-                status = nvm_ee_copy_flash_to_ram();
+                // NOTE: With lazy load regions are copied at first access!
+                #if ( 1 != NVM_CFG_EE_LAZY_LOAD_EN )
+                    status |= nvm_ee_copy_flash_to_ram();
+                #endif
             }
 
             // EEPROM emulation init success?
@@ -242,6 +1843,65 @@ nvm_status_t nvm_ee_init(void)
     return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		De-initialize EEPROM emulated NVM
+*
+* @brief    Releases RAM space of EEPROM emulation, so that next
+*           initialization loads regions from flash again.
+*
+* @note     Regions must be synced beforehand. With any region still dirty
+*           nothing is released and error is returned, so that un-synced
+*           RAM content is never dropped.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_deinit(void)
+{
+    nvm_status_t status = eNVM_OK;
+
+    for ( uint32_t region = 0U; ( region < eNVM_REGION_NUM_OF ) && ( true == gb_is_init ); region++ )
+    {
+        if  (   ( true == g_ee_region[region].dirty )
+            ||  (   ( true == g_sync_job.active )
+                &&  ( region == (uint32_t) g_sync_job.region )))
+        {
+            NVM_DBG_PRINT( "NVM_EE: Region #%d not synced at de-init!", region );
+            status = eNVM_ERROR;
+        }
+    }
+
+    if  (   ( true == gb_is_init )
+        &&  ( eNVM_OK == status ))
+    {
+        #if ( 1 != NVM_CFG_EE_STATIC_RAM_EN )
+            free( gp_ram_mem );
+            free( gp_dirty_mem );
+            free( gp_sync_mask );
+
+            #if ( 1 == NVM_CFG_CRC_EN )
+                free( gp_crc_mem );
+            #endif
+        #endif
+
+        gp_ram_mem      = NULL;
+        gp_dirty_mem    = NULL;
+        gp_sync_mask    = NULL;
+
+        #if ( 1 == NVM_CFG_CRC_EN )
+            gp_crc_mem = NULL;
+        #endif
+
+        memset( &g_ee_region, 0, sizeof( g_ee_region ));
+        memset( &g_sync_job, 0, sizeof( g_sync_job ));
+
+        gb_is_init = false;
+    }
+
+    return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Write data to EEPROM emulated memory
@@ -271,16 +1931,44 @@ nvm_status_t nvm_ee_write(const nvm_region_name_t region, const uint32_t addr, c
         // Calculate RAM offset
         ram_offset = nvm_ee_calc_ram_offset( region, addr );
 
-        // First copy data to RAM space
-        memcpy( &gp_ram_mem[ram_offset], p_data, size );
+        // Commit of A/B region in progress
+        #if ( 1 == NVM_CFG_EE_AB_EN )
+            if ( true == nvm_ee_ab_is_busy( region ))
+            {
+                status = eNVM_ERROR_BUSY;
+            }
+            else
+        #endif
+            {
+                // Make sure rest of region is in RAM
+                status = nvm_ee_load_region( region );
+            }
+
+        if ( eNVM_OK == status )
+        {
+            // First copy data to RAM space
+            nvm_ee_seq_begin( region );
+            memcpy( &gp_ram_mem[ram_offset], p_data, size );
+
+            // Keep integrity trailer in line with content
+            #if ( 1 == NVM_CFG_CRC_EN )
+                if ( true == gp_nvm_regions[region].crc_en )
+                {
+                    nvm_ee_update_crc( region, addr, size );
+                }
+            #endif
+
+            nvm_ee_seq_end( region );
+
+            // Remember what needs to be synced
+            nvm_ee_mark_dirty( region, addr, size );
+        }
     }
     else
     {
         status = eNVM_ERROR;
     }
 
-    NVM_DBG_PRINT( "NVM_EE: Write to region <%d> addr: 0x%04X. Status: %s. RAM addr: 0x%04X", region, addr, nvm_get_status_str( status ), ram_offset );
-
     return status;
 }
 
@@ -313,19 +2001,144 @@ nvm_status_t nvm_ee_read(const nvm_region_name_t region, const uint32_t addr, co
         // Calculate RAM offset
         ram_offset = nvm_ee_calc_ram_offset( region, addr );
 
-        // Read only from local RAM
-        memcpy( p_data, &gp_ram_mem[ram_offset], size );
+        // Load region at first access
+        status = nvm_ee_load_region( region );
+
+        if ( eNVM_OK == status )
+        {
+            // Read only from local RAM
+            memcpy( p_data, &gp_ram_mem[ram_offset], size );
+
+            // Stored content failed integrity check
+            #if ( 1 == NVM_CFG_CRC_EN )
+                if  (   ( true == gp_nvm_regions[region].crc_en )
+                    &&  ( false == g_ee_region[region].crc_ok ))
+                {
+                    status = eNVM_ERROR_CRC;
+                }
+            #endif
+        }
     }
     else
     {
         status = eNVM_ERROR;
     }
 
-    NVM_DBG_PRINT( "NVM_EE: Read from region <%d> addr: 0x%04X. Status: %s. RAM addr: 0x%04X", region, addr, nvm_get_status_str( status ), ram_offset );
-
     return status;
 }
 
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Compare data with content of EEPROM emulated memory
+    *
+    * @note     This function compares with RAM (inter-meadite storage space)
+    *           memory only!
+    *
+    * @param[in]    region  - NVM region
+    * @param[in]    addr    - Start address of compare
+    * @param[in]    size    - Number of bytes to compare
+    * @param[in]    p_data  - Data to compare
+    * @param[out]   p_equal - Data equal to stored content
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_ee_compare(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, bool * const p_equal)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        *p_equal = false;
+
+        if ( true == gb_is_init )
+        {
+            // Load region at first access
+            status = nvm_ee_load_region( region );
+
+            if ( eNVM_OK == status )
+            {
+                *p_equal = ( 0 == memcmp( &gp_ram_mem[ nvm_ee_calc_ram_offset( region, addr ) ], p_data, size ));
+            }
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Read data from EEPROM emulated memory without locking
+    *
+    * @brief    Seqlock read: data are copied from RAM and sequence counter of
+    *           region is checked before and after copy. If write raced the
+    *           copy, read is retried up to NVM_CFG_EE_SEQLOCK_RETRY times.
+    *
+    * @note     Fails if region is not EEPROM emulated, is not loaded yet or
+    *           all retries were interrupted by writer. Caller shall then fall
+    *           back to locked nvm_ee_read().
+    *
+    * @param[in]    region  - NVM region
+    * @param[in]    addr    - Start address of read operation
+    * @param[in]    size    - Number of bytes to read
+    * @param[out]   p_data  - Pointer to read data
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_ee_read_seqlock(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+    {
+        nvm_status_t    status  = eNVM_ERROR;
+        uint32_t        seq     = 0U;
+
+        if  (   ( true == gb_is_init )
+            &&  ( true == gp_nvm_regions[region].p_driver->ee_en ))
+        {
+            for ( uint32_t retry = 0U; ( retry < NVM_CFG_EE_SEQLOCK_RETRY ) && ( eNVM_OK != status ); retry++ )
+            {
+                seq = atomic_load_explicit( &g_ee_region[region].seq, memory_order_acquire );
+
+                // Region not loaded yet, lazy load needs lock
+                if ( false == g_ee_region[region].loaded )
+                {
+                    break;
+                }
+
+                // Integrity error is reported by locked path
+                #if ( 1 == NVM_CFG_CRC_EN )
+                    if  (   ( true == gp_nvm_regions[region].crc_en )
+                        &&  ( false == g_ee_region[region].crc_ok ))
+                    {
+                        break;
+                    }
+                #endif
+
+                // No write in progress
+                if ( 0U == ( seq & 1U ))
+                {
+                    memcpy( p_data, &gp_ram_mem[ nvm_ee_calc_ram_offset( region, addr ) ], size );
+
+                    atomic_thread_fence( memory_order_acquire );
+
+                    // Copy not interrupted by writer
+                    if ( seq == atomic_load_explicit( &g_ee_region[region].seq, memory_order_relaxed ))
+                    {
+                        status = eNVM_OK;
+                    }
+                }
+            }
+        }
+
+        return status;
+    }
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Erase data 
@@ -354,57 +2167,431 @@ nvm_status_t nvm_ee_erase(const nvm_region_name_t region, const uint32_t addr, c
         // Calculate RAM offset
         ram_offset = nvm_ee_calc_ram_offset( region, addr );
 
-        // Erase only local RAM
-        memset(  &gp_ram_mem[ram_offset], 0xFFU, size );
+        // Commit of A/B region in progress
+        #if ( 1 == NVM_CFG_EE_AB_EN )
+            if ( true == nvm_ee_ab_is_busy( region ))
+            {
+                status = eNVM_ERROR_BUSY;
+            }
+            else
+        #endif
+            {
+                // Make sure rest of region is in RAM
+                status = nvm_ee_load_region( region );
+            }
+
+        if ( eNVM_OK == status )
+        {
+            // Erase only local RAM
+            nvm_ee_seq_begin( region );
+            memset(  &gp_ram_mem[ram_offset], 0xFFU, size );
+
+            // Keep integrity trailer in line with content
+            #if ( 1 == NVM_CFG_CRC_EN )
+                if ( true == gp_nvm_regions[region].crc_en )
+                {
+                    nvm_ee_update_crc( region, addr, size );
+                }
+            #endif
+
+            nvm_ee_seq_end( region );
+
+            // Remember what needs to be synced
+            nvm_ee_mark_dirty( region, addr, size );
+        }
     }
     else
     {
         status = eNVM_ERROR;
     }
 
-    NVM_DBG_PRINT( "NVM_EE: Erasing from region <%d> addr: 0x%04X. Status: %s. RAM addr: 0x%04X", region, addr, nvm_get_status_str( status ), ram_offset );
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Prefetch region from FLASH -> RAM
+*
+* @brief    With lazy load (NVM_CFG_EE_LAZY_LOAD_EN) regions are copied to
+*           RAM at first access. This function enables to load critical
+*           region in advance.
+*
+* @note     Has no effect if region is already loaded or is not EEPROM
+*           emulated.
+*
+* @param[in]    region  - NVM region
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_prefetch(const nvm_region_name_t region)
+{
+    nvm_status_t status = eNVM_OK;
+
+    if  (   ( true == gb_is_init )
+        &&  ( true == gp_nvm_regions[region].p_driver->ee_en ))
+    {
+        status = nvm_ee_load_region( region );
+    }
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Copy data from FLASH -> RAM
+*		Get RAM space of EEPROM emulated region
+*
+* @note     Intended for EEPROM emulation storage back-ends only!
+*
+* @param[in]    region  - NVM region
+* @return 		p_ram	- Pointer to start of region inside RAM space
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t * nvm_ee_get_ram(const nvm_region_name_t region)
+{
+    return &gp_ram_mem[ g_ee_region[region].ram_offset ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Copy data from RAM -> FLASH
 *
 * @brief    This function copies content from local RAM (inter-mediate storage)
 *           to persistant storage memory - Flash.
 *
+*           Only region with modified (dirty) content is being erased and
+*           re-written. Sync of clean region has no effect on Flash.
+*
+*           When memory driver defines flash page size, region is synced
+*           page by page and only pages holding dirty blocks are erased and
+*           re-written. Data of other regions in shared page are preserved.
+*
+*           Without known page size erase of region might also erase other
+*           regions that share the same flash page. Blocks of such
+*           neighbouring regions (using same memory driver) that got wiped
+*           are detected by comparing flash against RAM and re-written.
+*           Their other dirty blocks stay dirty until their own sync.
+*
 * @note     Some upper level module might call that function even if EEPROM
 *           emulated method is not being used! Such approach makes handling
 *           data much easier.
 *
+* @param[in]    region  - NVM region
 * @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
 nvm_status_t nvm_ee_sync(const nvm_region_name_t region)
 {
-    nvm_status_t status = eNVM_OK;
-
+    nvm_status_t status     = eNVM_OK;
     /* NOTE:    Do not assert for init as this function is being called even 
      *          if EEPROM emulation is not in usage! Other modules (par_nvm, cli_nvm)
      *          are calling that function regarding of using EEPROM emulation or not!
      */
 
-    if ( true == gb_is_init )
+    bool         pending    = false;
+
+    // Run complete sync job
+    status = nvm_ee_sync_start( region );
+
+    if ( eNVM_OK == status )
     {
-        // Erase flash page
-        if ( eNVM_OK != gp_nvm_regions[region].p_driver->pf_nvm_erase( gp_nvm_regions[region].start_addr, gp_nvm_regions[region].size ))
+        do
         {
-            status = eNVM_ERROR;
+            status = nvm_ee_sync_step( &pending );
         }
+        while (( eNVM_OK == status ) && ( true == pending ));
+    }
 
-        // Copy content from RAM -> FLASH
-        status = nvm_ee_copy_ram_to_flash();
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start sync job of region
+*
+* @brief    Job is executed by calling nvm_ee_sync_step() until no work is
+*           pending. Sync of clean or non-emulated region starts no job.
+*
+* @note     Only single sync job can be in progress at a time.
+*
+* @param[in]    region  - NVM region
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_sync_start(const nvm_region_name_t region)
+{
+    nvm_status_t                status  = eNVM_OK;
+    const nvm_mem_driver_t *    p_drv   = NULL;
+
+    NVM_ASSERT( false == g_sync_job.active );
+
+    if ( true == g_sync_job.active )
+    {
+        status = eNVM_ERROR;
+    }
+    else if (   ( true == gb_is_init )
+            &&  ( true == gp_nvm_regions[region].p_driver->ee_en )
+            &&  ( true == g_ee_region[region].dirty ))
+    {
+        p_drv = gp_nvm_regions[region].p_driver;
+
+        g_sync_job.region = region;
+        g_sync_job.active = true;
+
+        // A/B region is written completely into inactive slot, snapshot of
+        // dirty blocks is kept to restore them on failure
+        #if ( 1 == NVM_CFG_EE_AB_EN )
+            if ( true == gp_nvm_regions[region].ab_en )
+            {
+                memcpy( gp_sync_mask, g_ee_region[region].p_dirty, ( nvm_ee_calc_dirty_words( region ) * sizeof( uint32_t )));
+                nvm_ee_clear_dirty( region );
+
+                g_sync_job.page_addr    = nvm_ee_ab_get_slot_addr( region, ( 1U - g_ee_region[region].ab_slot ));
+                g_sync_job.prog_addr    = g_sync_job.page_addr;
+                g_sync_job.erased       = g_ee_region[region].ab_erased;
+                g_sync_job.prog_only    = false;
+
+                // Inactive slot is being used
+                g_ee_region[region].ab_erased   = false;
+                g_ee_region[region].ab_busy     = true;
+            }
+            else
+        #endif
+
+        // Page by page sync works on snapshot of dirty blocks
+        if  (   ( NULL == p_drv->p_ee_log )
+            &&  ( 0U != p_drv->page_size ))
+        {
+            memcpy( gp_sync_mask, g_ee_region[region].p_dirty, ( nvm_ee_calc_dirty_words( region ) * sizeof( uint32_t )));
+            nvm_ee_clear_dirty( region );
+
+            g_sync_job.page_addr    = (( gp_nvm_regions[region].start_addr / p_drv->page_size ) * p_drv->page_size );
+            g_sync_job.erased       = false;
+            g_sync_job.prog_only    = false;
+
+            // Find first dirty page
+            g_sync_job.active = nvm_ee_sync_next_page();
+        }
+    }
+    else
+    {
+        // Nothing to sync
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute single step of sync job
+*
+* @brief    With known flash page size each step executes single flash
+*           operation: erase of page or program of single chunk of page.
+*           Pages without dirty blocks are skipped. A/B region is committed
+*           in steps as well (erase, program, footer). Log-structured and
+*           in-place sync without known page size are completed in single
+*           step.
+*
+* @note     On failure dirty blocks of region are kept for next sync.
+*
+* @param[out]   p_pending   - Sync job has remaining work
+* @return 		status	    - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_sync_step(bool * const p_pending)
+{
+    nvm_status_t                status  = eNVM_OK;
+    const nvm_region_name_t     region  = g_sync_job.region;
+    const bool                  active  = g_sync_job.active;
+
+    if ( true == g_sync_job.active )
+    {
+        // A/B region, commit into inactive slot
+        #if ( 1 == NVM_CFG_EE_AB_EN )
+            if ( true == gp_nvm_regions[region].ab_en )
+            {
+                status = nvm_ee_ab_sync_step();
+
+                if ( eNVM_OK != status )
+                {
+                    nvm_ee_restore_dirty( region, gp_sync_mask );
+                    g_sync_job.active = false;
+                }
+
+                // Region can be modified again once footer is written or commit failed
+                g_ee_region[region].ab_busy = g_sync_job.active;
+            }
+            else
+        #endif
+
+        // Log-structured EEPROM emulation
+        if ( NULL != gp_nvm_regions[region].p_driver->p_ee_log )
+        {
+            status = nvm_ee_sync_log( region );
+            g_sync_job.active = false;
+        }
+
+        // In-place EEPROM emulation, page by page
+        else if ( 0U != gp_nvm_regions[region].p_driver->page_size )
+        {
+            if ( false == g_sync_job.erased )
+            {
+                // Changes only clear bits, no erase needed
+                #if ( 1 == NVM_CFG_EE_PROG_ONLY_EN )
+                    if ( true == nvm_ee_sync_start_prog_only())
+                    {
+                        // Dirty blocks are programmed by next steps
+                    }
+                    else
+                #endif
+                    {
+                        status = nvm_ee_sync_erase_page();
+                    }
+            }
+            else
+            {
+                #if ( 1 == NVM_CFG_EE_PROG_ONLY_EN )
+                    if ( true == g_sync_job.prog_only )
+                    {
+                        status = nvm_ee_sync_program_dirty();
+                    }
+                    else
+                #endif
+                    {
+                        status = nvm_ee_sync_program_chunk();
+                    }
+
+                // Page completed, look for next dirty page
+                if  (   ( eNVM_OK == status )
+                    &&  ( false == g_sync_job.erased ))
+                {
+                    g_sync_job.active = nvm_ee_sync_next_page();
+                }
+            }
+
+            if ( eNVM_OK != status )
+            {
+                nvm_ee_restore_dirty( region, gp_sync_mask );
+                g_sync_job.active = false;
+            }
+        }
+
+        // In-place EEPROM emulation, unknown flash geometry
+        else
+        {
+            #if ( 1 == NVM_CFG_EE_PROG_ONLY_EN )
+                if ( true == nvm_ee_is_prog_only( region, g_ee_region[region].p_dirty, 0U, gp_nvm_regions[region].size ))
+                {
+                    status = nvm_ee_sync_prog_only( region );
+                }
+                else
+            #endif
+                {
+                    status = nvm_ee_sync_in_place( region );
+                }
+
+            g_sync_job.active = false;
+        }
     }
 
+    // Trailer is updated by each write, so committed content is sealed
+    #if ( 1 == NVM_CFG_CRC_EN )
+        if  (   ( true == active )
+            &&  ( false == g_sync_job.active )
+            &&  ( eNVM_OK == status ))
+        {
+            g_ee_region[region].crc_ok = true;
+        }
+    #else
+        (void) active;
+    #endif
+
+    *p_pending = g_sync_job.active;
+
     return status;
 }
 
+#if ( 1 == NVM_CFG_EE_AB_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Calculate size of single A/B slot
+    *
+    * @note     Slot holds region content followed by footer and is rounded
+    *           up to whole flash pages. Slot B follows slot A.
+    *
+    * @param[in]    p_region    - Region configuration
+    * @return 		size        - Size of slot in bytes
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint32_t nvm_ee_ab_calc_slot_size(const nvm_region_t * const p_region)
+    {
+        const uint32_t page_size    = ( 0U != p_region->p_driver->page_size ) ? p_region->p_driver->page_size : 1U;
+        const uint32_t prog_size    = ( 0U != p_region->p_driver->prog_size ) ? p_region->p_driver->prog_size : 1U;
+        const uint32_t footer_size  = ((( NVM_AB_FOOTER_SIZE + prog_size - 1U ) / prog_size ) * prog_size );
+
+        return ((( p_region->size + footer_size + page_size - 1U ) / page_size ) * page_size );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Erase inactive slot of A/B region
+    *
+    * @brief    Next sync of region then skips erase and only programs slot.
+    *           Intended to be called at idle time after sync.
+    *
+    * @note     Has no effect on region without A/B slots or with inactive
+    *           slot already erased. Slot of sync job in progress can not be
+    *           erased.
+    *
+    * @param[in]    region  - NVM region
+    * @return 		status	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    nvm_status_t nvm_ee_ab_erase_inactive(const nvm_region_name_t region)
+    {
+        nvm_status_t status = eNVM_OK;
+
+        NVM_ASSERT( true == gb_is_init );
+
+        if ( true == gb_is_init )
+        {
+            if ( true == gp_nvm_regions[region].ab_en )
+            {
+                if  (   ( true == g_sync_job.active )
+                    &&  ( region == g_sync_job.region ))
+                {
+                    status = eNVM_ERROR;
+                }
+                else
+                {
+                    // Active slot is known once region is loaded
+                    status = nvm_ee_load_region( region );
+
+                    if  (   ( eNVM_OK == status )
+                        &&  ( false == g_ee_region[region].ab_erased ))
+                    {
+                        if ( eNVM_OK != NVM_DEV_ERASE( gp_nvm_regions[region].p_driver, nvm_ee_ab_get_slot_addr( region, ( 1U - g_ee_region[region].ab_slot )), nvm_ee_ab_calc_slot_size( &gp_nvm_regions[region] )))
+                        {
+                            status = eNVM_ERROR;
+                        }
+                        else
+                        {
+                            g_ee_region[region].ab_erased = true;
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
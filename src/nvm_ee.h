@@ -32,11 +32,29 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
-nvm_status_t nvm_ee_init    (void);
-nvm_status_t nvm_ee_write   (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
-nvm_status_t nvm_ee_read    (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
-nvm_status_t nvm_ee_erase   (const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
-nvm_status_t nvm_ee_sync    (const nvm_region_name_t region);
+nvm_status_t nvm_ee_init       (void);
+nvm_status_t nvm_ee_deinit     (void);
+nvm_status_t nvm_ee_write      (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t nvm_ee_read       (const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+nvm_status_t nvm_ee_erase      (const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+nvm_status_t nvm_ee_sync       (const nvm_region_name_t region);
+nvm_status_t nvm_ee_sync_start (const nvm_region_name_t region);
+nvm_status_t nvm_ee_sync_step  (bool * const p_pending);
+nvm_status_t nvm_ee_prefetch   (const nvm_region_name_t region);
+uint8_t *    nvm_ee_get_ram    (const nvm_region_name_t region);
+
+#if ( 1 == NVM_CFG_EE_AB_EN )
+    uint32_t     nvm_ee_ab_calc_slot_size   (const nvm_region_t * const p_region);
+    nvm_status_t nvm_ee_ab_erase_inactive   (const nvm_region_name_t region);
+#endif
+
+#if ( 1 == NVM_CFG_WRITE_SKIP_EN )
+    nvm_status_t nvm_ee_compare(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, bool * const p_equal);
+#endif
+
+#if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+    nvm_status_t nvm_ee_read_seqlock(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+#endif
 
 #endif // __NVM_EE_H
 
@@ -0,0 +1,713 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_ee_log.c
+*@brief     NVM EEPROM Emulation - Log-structured storage
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_EE_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+*   Log-structured storage of EEPROM emulated regions.
+*
+*   Instead of erasing and re-writing region in place, changes are appended
+*   as records (address, size, data, CRC) into ring of flash pages. Only when
+*   active page gets full complete RAM image of all driver regions is written
+*   as snapshot into next page. Page header (sequence number) is written
+*   after snapshot, therefore power loss during compaction keeps previous
+*   page valid.
+*
+*   Page layout:
+*
+*       | Page header (magic, seq) | Record | Record | ... | Erased (0xFF) |
+*
+*   Record layout:
+*
+*       | Address (4) | Size (2) | CRC16 (2) | Data (aligned to 8 bytes) |
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nvm_ee_log.h"
+#include "nvm_ee.h"
+#include "nvm_stats.h"
+#include "nvm_trace.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Log page magic number ("NVML")
+ */
+#define NVM_EE_LOG_MAGIC                ( 0x4E564D4CUL )
+
+/**
+ *  Value of erased 32-bit word
+ */
+#define NVM_EE_LOG_ERASED_WORD          ( 0xFFFFFFFFUL )
+
+/**
+ *  Alignment of records inside log page in bytes
+ *
+ *  @note   Covers flash devices with 4 and 8 bytes programming unit.
+ */
+#define NVM_EE_LOG_ALIGN                ( 8U )
+
+/**
+ *  Maximum data size of single record
+ */
+#define NVM_EE_LOG_REC_DATA_MAX         ( 0xFFF8U )
+
+/**
+ *  Size of buffer for record CRC check
+ */
+#define NVM_EE_LOG_BUF_SIZE             ( 32U )
+
+/**
+ *  Log page header
+ */
+typedef struct
+{
+    uint32_t    magic;      /**<Magic number */
+    uint32_t    seq;        /**<Sequence number of page */
+} nvm_ee_log_page_hdr_t;
+
+/**
+ *  Log record header
+ */
+typedef struct
+{
+    uint32_t    addr;       /**<Start address of data */
+    uint16_t    size;       /**<Size of data in bytes */
+    uint16_t    crc;        /**<CRC16 of header address, size and data */
+} nvm_ee_log_rec_hdr_t;
+
+/**
+ *  Log state of memory driver
+ */
+typedef struct
+{
+    uint32_t    page;       /**<Active page index */
+    uint32_t    offset;     /**<Write offset inside active page */
+    uint32_t    seq;        /**<Sequence number of active page */
+    bool        valid;      /**<Active page exists */
+} nvm_ee_log_state_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Pointer to NVM configuration tables
+ */
+static const nvm_region_t *     gp_nvm_regions = NULL;
+static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
+
+/**
+ *  Log states
+ */
+static nvm_ee_log_state_t g_log_state[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t     nvm_ee_log_page_addr    (const nvm_mem_drv_name_t drv, const uint32_t page);
+static uint32_t     nvm_ee_log_align        (const uint32_t size);
+static uint16_t     nvm_ee_log_crc16        (const uint16_t crc, const uint8_t * const p_data, const uint32_t size);
+static uint16_t     nvm_ee_log_calc_rec_crc (const nvm_ee_log_rec_hdr_t * const p_hdr, const uint8_t * const p_data);
+static nvm_status_t nvm_ee_log_check_rec_crc(const nvm_mem_drv_name_t drv, const uint32_t addr, const nvm_ee_log_rec_hdr_t * const p_hdr, bool * const p_valid);
+static nvm_status_t nvm_ee_log_write_record (const nvm_mem_drv_name_t drv, const uint32_t page, uint32_t * const p_offset, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+static bool         nvm_ee_log_find_region  (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, nvm_region_name_t * const p_region);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get start address of log page
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    page    - Log page index
+* @return 		addr	- Start address of page
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_ee_log_page_addr(const nvm_mem_drv_name_t drv, const uint32_t page)
+{
+    return ( gp_nvm_drivers[drv].p_ee_log->start_addr + ( page * gp_nvm_drivers[drv].page_size ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Align size to record alignment
+*
+* @param[in]    size    - Size in bytes
+* @return 		size	- Aligned size in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nvm_ee_log_align(const uint32_t size)
+{
+    return ((( size + NVM_EE_LOG_ALIGN - 1U ) / NVM_EE_LOG_ALIGN ) * NVM_EE_LOG_ALIGN );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC16 (CCITT)
+*
+* @param[in]    crc     - Initial CRC value
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return 		crc	    - Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t nvm_ee_log_crc16(const uint16_t crc, const uint8_t * const p_data, const uint32_t size)
+{
+    uint16_t crc16 = crc;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        crc16 ^= (uint16_t)( (uint16_t) p_data[i] << 8U );
+
+        for ( uint8_t bit = 0U; bit < 8U; bit++ )
+        {
+            if ( crc16 & 0x8000U )
+            {
+                crc16 = (uint16_t)(( crc16 << 1U ) ^ 0x1021U );
+            }
+            else
+            {
+                crc16 = (uint16_t)( crc16 << 1U );
+            }
+        }
+    }
+
+    return crc16;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC of record
+*
+* @param[in]    p_hdr   - Record header
+* @param[in]    p_data  - Record data
+* @return 		crc	    - Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t nvm_ee_log_calc_rec_crc(const nvm_ee_log_rec_hdr_t * const p_hdr, const uint8_t * const p_data)
+{
+    uint16_t crc = 0xFFFFU;
+
+    crc = nvm_ee_log_crc16( crc, (const uint8_t*) &p_hdr->addr, sizeof( p_hdr->addr ));
+    crc = nvm_ee_log_crc16( crc, (const uint8_t*) &p_hdr->size, sizeof( p_hdr->size ));
+    crc = nvm_ee_log_crc16( crc, p_data, p_hdr->size );
+
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check CRC of record stored in flash
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    addr    - Address of record data in flash
+* @param[in]    p_hdr   - Record header
+* @param[out]   p_valid - Record CRC is valid
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_ee_log_check_rec_crc(const nvm_mem_drv_name_t drv, const uint32_t addr, const nvm_ee_log_rec_hdr_t * const p_hdr, bool * const p_valid)
+{
+    nvm_status_t    status                      = eNVM_OK;
+    uint8_t         buf[NVM_EE_LOG_BUF_SIZE]    = { 0 };
+    uint16_t        crc                         = 0xFFFFU;
+    uint32_t        chunk                       = 0U;
+
+    crc = nvm_ee_log_crc16( crc, (const uint8_t*) &p_hdr->addr, sizeof( p_hdr->addr ));
+    crc = nvm_ee_log_crc16( crc, (const uint8_t*) &p_hdr->size, sizeof( p_hdr->size ));
+
+    for ( uint32_t offset = 0U; offset < p_hdr->size; offset += chunk )
+    {
+        chunk = p_hdr->size - offset;
+
+        if ( chunk > NVM_EE_LOG_BUF_SIZE )
+        {
+            chunk = NVM_EE_LOG_BUF_SIZE;
+        }
+
+        if ( eNVM_OK != NVM_DEV_READ( &gp_nvm_drivers[drv], addr + offset, chunk, (uint8_t*) &buf ))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        crc = nvm_ee_log_crc16( crc, (const uint8_t*) &buf, chunk );
+    }
+
+    *p_valid = ( crc == p_hdr->crc );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write record(s) to log page
+*
+* @note     Data bigger than maximum record data size are split into multiple
+*           records. Space inside page must be checked by caller!
+*
+* @param[in]    drv         - Memory driver
+* @param[in]    page        - Log page index
+* @param[in,out]p_offset    - Write offset inside page. Set to page size on failure.
+* @param[in]    addr        - Address of data
+* @param[in]    size        - Size of data in bytes
+* @param[in]    p_data      - Pointer to data
+* @return 		status	    - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_ee_log_write_record(const nvm_mem_drv_name_t drv, const uint32_t page, uint32_t * const p_offset, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    nvm_status_t            status                      = eNVM_OK;
+    nvm_ee_log_rec_hdr_t    hdr                         = { 0 };
+    uint8_t                 tail[NVM_EE_LOG_ALIGN]      = { 0 };
+    uint32_t                chunk                       = 0U;
+    uint32_t                body                        = 0U;
+    uint32_t                rec_addr                    = 0U;
+
+    for ( uint32_t offset = 0U; ( offset < size ) && ( eNVM_OK == status ); offset += chunk )
+    {
+        chunk = size - offset;
+
+        if ( chunk > NVM_EE_LOG_REC_DATA_MAX )
+        {
+            chunk = NVM_EE_LOG_REC_DATA_MAX;
+        }
+
+        rec_addr    = nvm_ee_log_page_addr( drv, page ) + *p_offset;
+        hdr.addr    = addr + offset;
+        hdr.size    = (uint16_t) chunk;
+        hdr.crc     = nvm_ee_log_calc_rec_crc( &hdr, &p_data[offset] );
+
+        // Header
+        if ( eNVM_OK != NVM_DEV_WRITE( &gp_nvm_drivers[drv], rec_addr, sizeof( nvm_ee_log_rec_hdr_t ), (const uint8_t*) &hdr ))
+        {
+            status = eNVM_ERROR;
+        }
+        rec_addr += sizeof( nvm_ee_log_rec_hdr_t );
+
+        // Aligned part of data
+        body = (( chunk / NVM_EE_LOG_ALIGN ) * NVM_EE_LOG_ALIGN );
+
+        if ( body > 0U )
+        {
+            if ( eNVM_OK != NVM_DEV_WRITE( &gp_nvm_drivers[drv], rec_addr, body, &p_data[offset] ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+
+        // Tail of data padded with erased value
+        if ( body < chunk )
+        {
+            memset( &tail, 0xFFU, sizeof( tail ));
+            memcpy( &tail, &p_data[ offset + body ], ( chunk - body ));
+
+            if ( eNVM_OK != NVM_DEV_WRITE( &gp_nvm_drivers[drv], rec_addr + body, NVM_EE_LOG_ALIGN, (const uint8_t*) &tail ))
+            {
+                status = eNVM_ERROR;
+            }
+        }
+
+        // Torn record ends replay, later records would be lost. Page is
+        // closed so that next write compacts log into fresh page.
+        if ( eNVM_OK != status )
+        {
+            *p_offset = gp_nvm_drivers[drv].page_size;
+        }
+        else
+        {
+            *p_offset += nvm_ee_log_calc_record_size( chunk );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find EEPROM emulated region that contains address range
+*
+* @param[in]    drv         - Memory driver
+* @param[in]    addr        - Start address
+* @param[in]    size        - Size in bytes
+* @param[out]   p_region    - Found region
+* @return 		found	    - Region found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_ee_log_find_region(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, nvm_region_name_t * const p_region)
+{
+    bool found = false;
+
+    for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+    {
+        if  (   ( &gp_nvm_drivers[drv] == gp_nvm_regions[region].p_driver )
+            &&  ( addr >= gp_nvm_regions[region].start_addr )
+            &&  (( addr + size ) <= ( gp_nvm_regions[region].start_addr + gp_nvm_regions[region].size )))
+        {
+            *p_region   = (nvm_region_name_t) region;
+            found       = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_EE_LOG_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM EEPROM Emulation log API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize log-structured storage
+*
+* @brief    Checks log area configuration of all memory drivers that use
+*           log-structured EEPROM emulation.
+*
+* @note     Snapshot of all driver regions must fit into single log page!
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_log_init(void)
+{
+    nvm_status_t    status          = eNVM_OK;
+    uint32_t        snapshot_size   = 0U;
+
+    // Get table configuration
+    gp_nvm_regions = nvm_cfg_get_regions();
+    gp_nvm_drivers = nvm_cfg_get_drivers();
+
+    NVM_ASSERT( NULL != gp_nvm_regions );
+    NVM_ASSERT( NULL != gp_nvm_drivers );
+
+    for ( uint32_t drv = 0U; drv < eNVM_MEM_DRV_NUM_OF; drv++ )
+    {
+        if  (   ( true == gp_nvm_drivers[drv].ee_en )
+            &&  ( NULL != gp_nvm_drivers[drv].p_ee_log ))
+        {
+            // Space of page header
+            snapshot_size = sizeof( nvm_ee_log_page_hdr_t );
+
+            // Space of all driver regions
+            for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+            {
+                if ( &gp_nvm_drivers[drv] == gp_nvm_regions[region].p_driver )
+                {
+                    snapshot_size += nvm_ee_log_calc_record_size( gp_nvm_regions[region].size );
+                }
+            }
+
+            if  (   ( 0U == gp_nvm_drivers[drv].page_size )
+                ||  ( 0U != ( gp_nvm_drivers[drv].page_size % NVM_EE_LOG_ALIGN ))
+                ||  ( gp_nvm_drivers[drv].p_ee_log->page_num < 2U )
+                ||  ( snapshot_size > gp_nvm_drivers[drv].page_size ))
+            {
+                status = eNVM_ERROR;
+
+                NVM_DBG_PRINT( "NVM_EE_LOG: Invalid log configuration of driver #%d!", drv );
+                NVM_ASSERT( 0 );
+            }
+
+            g_log_state[drv].valid = false;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load all driver regions from log into RAM
+*
+* @brief    Finds newest valid log page and replays its records into RAM.
+*           Replay stops at first erased or corrupted (torn) record. In case
+*           of corrupted record next append will compact log into next page.
+*
+* @param[in]    drv     - Memory driver
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_log_load(const nvm_mem_drv_name_t drv)
+{
+    nvm_status_t                status      = eNVM_OK;
+    nvm_ee_log_state_t * const  p_state     = &g_log_state[drv];
+    const uint32_t              page_size   = gp_nvm_drivers[drv].page_size;
+    nvm_ee_log_page_hdr_t       page_hdr    = { 0 };
+    nvm_ee_log_rec_hdr_t        rec_hdr     = { 0 };
+    nvm_region_name_t           region      = (nvm_region_name_t) 0;
+    uint32_t                    rec_addr    = 0U;
+    bool                        rec_valid   = false;
+
+    // Regions without records are blank
+    for ( uint32_t reg_idx = 0U; reg_idx < eNVM_REGION_NUM_OF; reg_idx++ )
+    {
+        if ( &gp_nvm_drivers[drv] == gp_nvm_regions[reg_idx].p_driver )
+        {
+            memset( nvm_ee_get_ram((nvm_region_name_t) reg_idx ), 0xFFU, gp_nvm_regions[reg_idx].size );
+        }
+    }
+
+    // Find newest valid page
+    p_state->valid = false;
+
+    for ( uint32_t page = 0U; page < gp_nvm_drivers[drv].p_ee_log->page_num; page++ )
+    {
+        if ( eNVM_OK != NVM_DEV_READ( &gp_nvm_drivers[drv], nvm_ee_log_page_addr( drv, page ), sizeof( page_hdr ), (uint8_t*) &page_hdr ))
+        {
+            status = eNVM_ERROR;
+            break;
+        }
+
+        if  (   ( NVM_EE_LOG_MAGIC == page_hdr.magic )
+            &&  ( NVM_EE_LOG_ERASED_WORD != page_hdr.seq )
+            &&  (   ( false == p_state->valid )
+                ||  ( page_hdr.seq > p_state->seq )))
+        {
+            p_state->page   = page;
+            p_state->seq    = page_hdr.seq;
+            p_state->valid  = true;
+        }
+    }
+
+    // Replay records of active page
+    if  (   ( eNVM_OK == status )
+        &&  ( true == p_state->valid ))
+    {
+        p_state->offset = sizeof( nvm_ee_log_page_hdr_t );
+
+        while (( p_state->offset + sizeof( nvm_ee_log_rec_hdr_t )) <= page_size )
+        {
+            rec_addr = nvm_ee_log_page_addr( drv, p_state->page ) + p_state->offset;
+
+            if ( eNVM_OK != NVM_DEV_READ( &gp_nvm_drivers[drv], rec_addr, sizeof( rec_hdr ), (uint8_t*) &rec_hdr ))
+            {
+                status = eNVM_ERROR;
+                break;
+            }
+
+            // End of log
+            if  (   ( NVM_EE_LOG_ERASED_WORD == rec_hdr.addr )
+                &&  ( 0xFFFFU == rec_hdr.size )
+                &&  ( 0xFFFFU == rec_hdr.crc ))
+            {
+                break;
+            }
+
+            rec_valid = false;
+
+            if  (   ( rec_hdr.size > 0U )
+                &&  (( p_state->offset + nvm_ee_log_calc_record_size( rec_hdr.size )) <= page_size ))
+            {
+                status = nvm_ee_log_check_rec_crc( drv, rec_addr + sizeof( rec_hdr ), &rec_hdr, &rec_valid );
+            }
+
+            // Torn or corrupted record
+            if  (   ( eNVM_OK != status )
+                ||  ( false == rec_valid ))
+            {
+                NVM_DBG_PRINT( "NVM_EE_LOG: Corrupted record at 0x%08X!", rec_addr );
+
+                // Force compaction at next append
+                p_state->offset = page_size;
+                break;
+            }
+
+            // Apply record to RAM. Records of no longer existing regions are ignored.
+            if ( true == nvm_ee_log_find_region( drv, rec_hdr.addr, rec_hdr.size, &region ))
+            {
+                if ( eNVM_OK != NVM_DEV_READ( &gp_nvm_drivers[drv], rec_addr + sizeof( rec_hdr ), rec_hdr.size, &nvm_ee_get_ram( region )[ rec_hdr.addr - gp_nvm_regions[region].start_addr ] ))
+                {
+                    status = eNVM_ERROR;
+                    break;
+                }
+            }
+
+            p_state->offset += nvm_ee_log_calc_record_size( rec_hdr.size );
+        }
+    }
+
+    NVM_TRACE( eNVM_TRACE_LOG_LOAD, drv, p_state->page, p_state->seq, status );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Append data to log
+*
+* @note     Caller must check that there is enough free space in active page
+*           with "nvm_ee_log_get_free()" and "nvm_ee_log_calc_record_size()"!
+*
+* @param[in]    drv     - Memory driver
+* @param[in]    addr    - Start address of data
+* @param[in]    size    - Size of data in bytes
+* @param[in]    p_data  - Pointer to data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_log_append(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    nvm_status_t status = eNVM_OK;
+
+    NVM_ASSERT( nvm_ee_log_calc_record_size( size ) <= nvm_ee_log_get_free( drv ));
+
+    if ( nvm_ee_log_calc_record_size( size ) <= nvm_ee_log_get_free( drv ))
+    {
+        status = nvm_ee_log_write_record( drv, g_log_state[drv].page, &g_log_state[drv].offset, addr, size, p_data );
+    }
+    else
+    {
+        status = eNVM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Compact log into next page
+*
+* @brief    Erases next page of log ring, writes snapshot of all driver
+*           regions from RAM and at the end commits page by writing page
+*           header with incremented sequence number.
+*
+* @param[in]    drv     - Memory driver
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_ee_log_compact(const nvm_mem_drv_name_t drv)
+{
+    nvm_status_t                status      = eNVM_OK;
+    nvm_ee_log_state_t * const  p_state     = &g_log_state[drv];
+    nvm_ee_log_page_hdr_t       page_hdr    = { 0 };
+    uint32_t                    page        = 0U;
+    uint32_t                    offset      = sizeof( nvm_ee_log_page_hdr_t );
+
+    // Next page in ring
+    if ( true == p_state->valid )
+    {
+        page = (( p_state->page + 1U ) % gp_nvm_drivers[drv].p_ee_log->page_num );
+    }
+
+    // Erase next page
+    if ( eNVM_OK != NVM_DEV_ERASE( &gp_nvm_drivers[drv], nvm_ee_log_page_addr( drv, page ), gp_nvm_drivers[drv].page_size ))
+    {
+        status = eNVM_ERROR;
+    }
+
+    // Snapshot of all driver regions
+    for ( uint32_t region = 0U; ( region < eNVM_REGION_NUM_OF ) && ( eNVM_OK == status ); region++ )
+    {
+        if ( &gp_nvm_drivers[drv] == gp_nvm_regions[region].p_driver )
+        {
+            status |= nvm_ee_log_write_record( drv, page, &offset, gp_nvm_regions[region].start_addr, gp_nvm_regions[region].size, nvm_ee_get_ram((nvm_region_name_t) region ));
+        }
+    }
+
+    // Commit page
+    if ( eNVM_OK == status )
+    {
+        page_hdr.magic  = NVM_EE_LOG_MAGIC;
+        page_hdr.seq    = ( true == p_state->valid ) ? ( p_state->seq + 1U ) : 1U;
+
+        if ( eNVM_OK != NVM_DEV_WRITE( &gp_nvm_drivers[drv], nvm_ee_log_page_addr( drv, page ), sizeof( page_hdr ), (const uint8_t*) &page_hdr ))
+        {
+            status = eNVM_ERROR;
+        }
+        else
+        {
+            p_state->page   = page;
+            p_state->seq    = page_hdr.seq;
+            p_state->offset = offset;
+            p_state->valid  = true;
+        }
+    }
+
+    NVM_TRACE( eNVM_TRACE_LOG_COMPACT, drv, page, page_hdr.seq, status );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get free space of active log page
+*
+* @param[in]    drv     - Memory driver
+* @return 		free	- Free space in bytes. Zero if there is no active page.
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nvm_ee_log_get_free(const nvm_mem_drv_name_t drv)
+{
+    uint32_t free_space = 0U;
+
+    if  (   ( true == g_log_state[drv].valid )
+        &&  ( g_log_state[drv].offset < gp_nvm_drivers[drv].page_size ))
+    {
+        free_space = ( gp_nvm_drivers[drv].page_size - g_log_state[drv].offset );
+    }
+
+    return free_space;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate space in log needed for data
+*
+* @param[in]    size    - Size of data in bytes
+* @return 		size	- Size of record(s) in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nvm_ee_log_calc_record_size(const uint32_t size)
+{
+    const uint32_t full_records = ( size / NVM_EE_LOG_REC_DATA_MAX );
+    const uint32_t rest         = ( size % NVM_EE_LOG_REC_DATA_MAX );
+    uint32_t       rec_size     = ( full_records * ( sizeof( nvm_ee_log_rec_hdr_t ) + NVM_EE_LOG_REC_DATA_MAX ));
+
+    if ( rest > 0U )
+    {
+        rec_size += ( sizeof( nvm_ee_log_rec_hdr_t ) + nvm_ee_log_align( rest ));
+    }
+
+    return rec_size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
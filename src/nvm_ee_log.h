@@ -0,0 +1,48 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_ee_log.h
+*@brief     NVM EEPROM Emulation - Log-structured storage
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_EE_LOG_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_EE_LOG_H
+#define __NVM_EE_LOG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t    nvm_ee_log_init             (void);
+nvm_status_t    nvm_ee_log_load             (const nvm_mem_drv_name_t drv);
+nvm_status_t    nvm_ee_log_append           (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t    nvm_ee_log_compact          (const nvm_mem_drv_name_t drv);
+uint32_t        nvm_ee_log_get_free         (const nvm_mem_drv_name_t drv);
+uint32_t        nvm_ee_log_calc_record_size (const uint32_t size);
+
+#endif // __NVM_EE_LOG_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,126 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_layout.h
+*@brief     NVM region table generation and compile time layout validation
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_LAYOUT
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Region enumeration, region table, EEPROM emulation RAM size and layout
+* 	checks are generated from single list of regions in "nvm_cfg.h":
+*
+* 	@code
+* 	#define NVM_CFG_REGION_TABLE( X )                                                                                            \
+* 		X( INT_FLASH_DEV_PAR,	"Device Parameters",	INT_FLASH,	0x000F7000U,	0x400U,		false,	false )                                  \
+* 		X( INT_FLASH_CLI,		"CLI settings",			INT_FLASH,	0x000F7400U,	0x100U,		false,	false )
+* 	@endcode
+*
+* 	Row columns are: region (eNVM_REGION_x), name, memory driver
+* 	(eNVM_MEM_DRV_x), start address, size, CRC trailer and A/B slots.
+*
+* 	Geometry of each memory driver used by the table must be given with:
+*
+* 	@code
+* 	#define NVM_CFG_DRV_INT_FLASH_EE_EN		( true )
+* 	#define NVM_CFG_DRV_INT_FLASH_PAGE_SIZE	( 0x1000U )
+* 	#define NVM_CFG_DRV_INT_FLASH_PROG_SIZE	( 8U )
+* 	#define NVM_CFG_DRV_INT_FLASH_MEM_SIZE		( 0x100000U )
+* 	@endcode
+*
+* 	@note	This file is included by "nvm_cfg.h", therefore it contains
+* 			only macros. Checks expand to static assertions and are
+* 			placed into "nvm_cfg.c".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_LAYOUT_H
+#define __NVM_LAYOUT_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Driver geometry of region row
+ */
+#define NVM_LAYOUT_EE_EN( drv )                                 ( NVM_CFG_DRV_##drv##_EE_EN )
+#define NVM_LAYOUT_PAGE_SIZE( drv )                             ( NVM_CFG_DRV_##drv##_PAGE_SIZE )
+#define NVM_LAYOUT_PROG_SIZE( drv )                             ( NVM_CFG_DRV_##drv##_PROG_SIZE )
+#define NVM_LAYOUT_MEM_SIZE( drv )                              ( NVM_CFG_DRV_##drv##_MEM_SIZE )
+
+/**
+ * 	Round up to multiple of unit. Unit 0 means byte granularity.
+ */
+#define NVM_LAYOUT_UNIT( unit )                                 (( 0U != ( unit )) ? ( unit ) : 1U )
+#define NVM_LAYOUT_ROUND_UP( x, unit )                          (((( x ) + NVM_LAYOUT_UNIT( unit ) - 1U ) / NVM_LAYOUT_UNIT( unit )) * NVM_LAYOUT_UNIT( unit ))
+
+/**
+ * 	Memory occupied by region, A/B region takes two page aligned slots
+ * 	with footer
+ */
+#define NVM_LAYOUT_AB_SLOT_SIZE( drv, len )                     NVM_LAYOUT_ROUND_UP(( len ) + NVM_LAYOUT_ROUND_UP( NVM_AB_FOOTER_SIZE, NVM_LAYOUT_PROG_SIZE( drv )), NVM_LAYOUT_PAGE_SIZE( drv ))
+#define NVM_LAYOUT_FOOTPRINT( drv, len, ab )                    (( ab ) ? ( 2U * NVM_LAYOUT_AB_SLOT_SIZE( drv, len )) : ( len ))
+
+/**
+ * 	Region enumeration entry
+ *
+ * 	@note	Use as: NVM_CFG_REGION_TABLE( NVM_LAYOUT_ENUM )
+ */
+#define NVM_LAYOUT_ENUM( reg, str, drv, start, len, crc, ab )   eNVM_REGION_##reg,
+
+/**
+ * 	Region table entry
+ *
+ * 	@note	Use as: NVM_CFG_REGION_TABLE( NVM_LAYOUT_REGION ). Expects
+ * 			memory driver table named "g_mem_driver".
+ */
+#define NVM_LAYOUT_REGION( reg, str, drv, start, len, crc, ab )                                                                 \
+    [eNVM_REGION_##reg] = { .name = ( str ), .start_addr = ( start ), .size = ( len ), .p_driver = &g_mem_driver[ eNVM_MEM_DRV_##drv ], .crc_en = ( crc ), .ab_en = ( ab ) },
+
+/**
+ * 	RAM space of EEPROM emulation needed by all regions
+ *
+ * 	@note	Use as: ( 0U NVM_CFG_REGION_TABLE( NVM_LAYOUT_EE_RAM ))
+ */
+#define NVM_LAYOUT_EE_RAM( reg, str, drv, start, len, crc, ab ) + ( NVM_LAYOUT_EE_EN( drv ) ? ( len ) : 0U )
+
+/**
+ * 	Compile time checks of region
+ *
+ * 	@note	Use as: NVM_CFG_REGION_TABLE( NVM_LAYOUT_CHECK ). Overlap of
+ * 			regions is checked at initialization.
+ */
+#define NVM_LAYOUT_CHECK( reg, str, drv, start, len, crc, ab )                                                                  \
+    NVM_STATIC_ASSERT(( len ) > 0U, "NVM region \"" str "\" has no size!" );                                                    \
+    NVM_STATIC_ASSERT((( 0U == NVM_LAYOUT_MEM_SIZE( drv )) ||                                                                   \
+                       ((( start ) <= NVM_LAYOUT_MEM_SIZE( drv )) &&                                                            \
+                        ( NVM_LAYOUT_FOOTPRINT( drv, len, ab ) <= ( NVM_LAYOUT_MEM_SIZE( drv ) - ( start ))))),                 \
+                       "NVM region \"" str "\" exceeds memory device!" );                                                       \
+    NVM_STATIC_ASSERT(( !( crc ) || (( 1 == NVM_CFG_CRC_EN ) && (( len ) > NVM_CRC_SIZE ))),                                    \
+                       "NVM region \"" str "\" has no space for CRC or CRC is disabled!" );                                     \
+    NVM_STATIC_ASSERT(( !( ab ) || (( 1 == NVM_CFG_EE_AB_EN ) && NVM_LAYOUT_EE_EN( drv ) &&                                     \
+                       ( 0U != NVM_LAYOUT_PAGE_SIZE( drv )) && ( 0U == (( start ) % NVM_LAYOUT_UNIT( NVM_LAYOUT_PAGE_SIZE( drv )))) && \
+                       ( NVM_LAYOUT_PROG_SIZE( drv ) <= NVM_AB_FOOTER_MAX_SIZE ) &&                                             \
+                       ( 0U == (( len ) % NVM_LAYOUT_UNIT( NVM_LAYOUT_PROG_SIZE( drv )))))),                                    \
+                       "NVM region \"" str "\" invalid A/B layout!" );                                                          \
+    NVM_STATIC_ASSERT(( !NVM_LAYOUT_EE_EN( drv ) || ( ab ) || ( 0U == NVM_LAYOUT_PAGE_SIZE( drv )) ||                           \
+                       (( 0U == (( start ) % NVM_LAYOUT_UNIT( NVM_LAYOUT_PAGE_SIZE( drv )))) &&                                 \
+                        ( 0U == (( len ) % NVM_LAYOUT_UNIT( NVM_LAYOUT_PAGE_SIZE( drv ))))) ||                                  \
+                       ( NVM_LAYOUT_PAGE_SIZE( drv ) <= NVM_CFG_EE_PAGE_BUF_SIZE )),                                            \
+                       "NVM region \"" str "\" shares flash page, NVM_CFG_EE_PAGE_BUF_SIZE too small!" );
+
+#endif // __NVM_LAYOUT_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
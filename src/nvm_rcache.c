@@ -0,0 +1,370 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_rcache.c
+*@brief     NVM read cache of non-emulated memory drivers
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_RCACHE
+* @{ <!-- BEGIN GROUP -->
+*
+*   Read cache of fixed size blocks of memory drivers.
+*
+*   Each memory driver has its own pool of NVM_CFG_RCACHE_BLOCK_NUM blocks
+*   of NVM_CFG_RCACHE_BLOCK_SIZE bytes, allocated statically, so that
+*   drivers locked separately never share a block. Each block caches block
+*   aligned device range. On miss least recently used block of driver pool
+*   is replaced. Writes update cached blocks, erases invalidate them.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nvm_rcache.h"
+
+#if ( 1 == NVM_CFG_RCACHE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Cache block
+ */
+typedef struct
+{
+    uint8_t             data[NVM_CFG_RCACHE_BLOCK_SIZE];    /**<Cached device content */
+    uint32_t            addr;                               /**<Block aligned device address */
+    uint32_t            used;                               /**<Time of last use, for LRU replacement */
+    bool                valid;                              /**<Block holds device content */
+} nvm_rcache_block_t;
+
+/**
+ *  Hit/miss counters
+ */
+typedef struct
+{
+    uint32_t hit;   /**<Number of blocks served from cache */
+    uint32_t miss;  /**<Number of blocks read from device */
+} nvm_rcache_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ *  Pointer to memory drivers configuration table
+ */
+static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
+
+/**
+ *  Block pool per memory driver
+ */
+static nvm_rcache_block_t g_rcache[eNVM_MEM_DRV_NUM_OF][NVM_CFG_RCACHE_BLOCK_NUM] = { 0 };
+
+/**
+ *  Use counter for LRU replacement per memory driver
+ */
+static uint32_t g_rcache_time[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+/**
+ *  Counters per memory driver
+ */
+static nvm_rcache_stats_t g_rcache_stats[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static nvm_rcache_block_t * nvm_rcache_find     (const nvm_mem_drv_name_t drv, const uint32_t addr);
+static nvm_rcache_block_t * nvm_rcache_get_lru  (const nvm_mem_drv_name_t drv);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find cached block
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Block aligned device address
+* @return 		p_block	- Cached block or NULL if not cached
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_rcache_block_t * nvm_rcache_find(const nvm_mem_drv_name_t drv, const uint32_t addr)
+{
+    nvm_rcache_block_t * p_block = NULL;
+
+    for ( uint32_t i = 0U; i < NVM_CFG_RCACHE_BLOCK_NUM; i++ )
+    {
+        if  (   ( true == g_rcache[drv][i].valid )
+            &&  ( addr == g_rcache[drv][i].addr ))
+        {
+            p_block = &g_rcache[drv][i];
+            break;
+        }
+    }
+
+    return p_block;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get block to replace
+*
+* @param[in]	drv	    - Memory driver
+* @return 		p_block	- Free or least recently used block of driver pool
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_rcache_block_t * nvm_rcache_get_lru(const nvm_mem_drv_name_t drv)
+{
+    nvm_rcache_block_t * const  p_pool  = g_rcache[drv];
+    nvm_rcache_block_t *        p_block = &p_pool[0];
+
+    for ( uint32_t i = 0U; i < NVM_CFG_RCACHE_BLOCK_NUM; i++ )
+    {
+        if ( false == p_pool[i].valid )
+        {
+            p_block = &p_pool[i];
+            break;
+        }
+
+        // Unsigned difference handles wrap of use counter
+        if (( g_rcache_time[drv] - p_pool[i].used ) > ( g_rcache_time[drv] - p_block->used ))
+        {
+            p_block = &p_pool[i];
+        }
+    }
+
+    return p_block;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_RCACHE_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM read cache API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize read cache
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_rcache_init(void)
+{
+    gp_nvm_drivers = nvm_cfg_get_drivers();
+    NVM_ASSERT( NULL != gp_nvm_drivers );
+
+    memset( &g_rcache, 0, sizeof( g_rcache ));
+    memset( &g_rcache_stats, 0, sizeof( g_rcache_stats ));
+    memset( &g_rcache_time, 0, sizeof( g_rcache_time ));
+    gb_is_init = true;
+
+    return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if memory driver reads through cache
+*
+* @param[in]	drv	    - Memory driver
+* @return 		en	    - Read cache enabled
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nvm_rcache_is_en(const nvm_mem_drv_name_t drv)
+{
+    return (( true == gb_is_init ) && ( true == gp_nvm_drivers[drv].rcache_en ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read through cache
+*
+* @brief    Read is split into cache blocks. Cached blocks are copied,
+*           missing blocks are read as a whole with fill function and
+*           replace least recently used block.
+*
+* @note     Read covering whole pool or more bypasses cache, so that
+*           single large read does not evict all hot blocks. If block
+*           can not be filled (e.g. block exceeds device), requested part
+*           is read directly.
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @param[in]	pf_fill	- Function reading device content
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_rcache_read(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_nvm_rcache_fill_t pf_fill)
+{
+    nvm_status_t    status  = eNVM_OK;
+    uint32_t        done    = 0U;
+
+    // Large read
+    if ( size >= ( NVM_CFG_RCACHE_BLOCK_SIZE * NVM_CFG_RCACHE_BLOCK_NUM ))
+    {
+        g_rcache_stats[drv].miss++;
+        status = pf_fill( drv, addr, size, p_data );
+        done = size;
+    }
+
+    while (( done < size ) && ( eNVM_OK == status ))
+    {
+        const uint32_t          cur_addr    = ( addr + done );
+        const uint32_t          block_addr  = ( cur_addr - ( cur_addr % NVM_CFG_RCACHE_BLOCK_SIZE ));
+        const uint32_t          off         = ( cur_addr - block_addr );
+        uint32_t                len         = ( NVM_CFG_RCACHE_BLOCK_SIZE - off );
+        nvm_rcache_block_t *    p_block     = nvm_rcache_find( drv, block_addr );
+
+        if ( len > ( size - done ))
+        {
+            len = ( size - done );
+        }
+
+        // Hit
+        if ( NULL != p_block )
+        {
+            g_rcache_stats[drv].hit++;
+        }
+
+        // Miss
+        else
+        {
+            g_rcache_stats[drv].miss++;
+
+            p_block         = nvm_rcache_get_lru( drv );
+            p_block->valid  = false;
+
+            if ( eNVM_OK == pf_fill( drv, block_addr, NVM_CFG_RCACHE_BLOCK_SIZE, (uint8_t*) &p_block->data ))
+            {
+                p_block->addr   = block_addr;
+                p_block->valid  = true;
+            }
+            else
+            {
+                p_block = NULL;
+            }
+        }
+
+        if ( NULL != p_block )
+        {
+            p_block->used = ++g_rcache_time[drv];
+            memcpy( &p_data[done], &p_block->data[off], len );
+        }
+
+        // Block not cacheable
+        else
+        {
+            status = pf_fill( drv, cur_addr, len, &p_data[done] );
+        }
+
+        done += len;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Update cached blocks by written data
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Written data
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_rcache_update(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    for ( uint32_t i = 0U; i < NVM_CFG_RCACHE_BLOCK_NUM; i++ )
+    {
+        nvm_rcache_block_t * const p_block = &g_rcache[drv][i];
+
+        if  (   ( true == p_block->valid )
+            &&  ( addr < ( p_block->addr + NVM_CFG_RCACHE_BLOCK_SIZE ))
+            &&  ( p_block->addr < ( addr + size )))
+        {
+            const uint32_t start    = (( addr > p_block->addr ) ? addr : p_block->addr );
+            const uint32_t end      = ((( addr + size ) < ( p_block->addr + NVM_CFG_RCACHE_BLOCK_SIZE )) ? ( addr + size ) : ( p_block->addr + NVM_CFG_RCACHE_BLOCK_SIZE ));
+
+            memcpy( &p_block->data[ start - p_block->addr ], &p_data[ start - addr ], ( end - start ));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Invalidate cached blocks overlapping range
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_rcache_invalidate(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size)
+{
+    for ( uint32_t i = 0U; i < NVM_CFG_RCACHE_BLOCK_NUM; i++ )
+    {
+        if  (   ( addr < ( g_rcache[drv][i].addr + NVM_CFG_RCACHE_BLOCK_SIZE ))
+            &&  ( g_rcache[drv][i].addr < ( addr + size )))
+        {
+            g_rcache[drv][i].valid = false;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get read cache counters of memory driver
+*
+* @param[in]	drv	    - Memory driver
+* @param[out]	p_hit	- Number of blocks served from cache
+* @param[out]	p_miss	- Number of blocks read from device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_rcache_get_stats(const nvm_mem_drv_name_t drv, uint32_t * const p_hit, uint32_t * const p_miss)
+{
+    *p_hit  = g_rcache_stats[drv].hit;
+    *p_miss = g_rcache_stats[drv].miss;
+}
+
+#endif // ( 1 == NVM_CFG_RCACHE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
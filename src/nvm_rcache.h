@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_rcache.h
+*@brief     NVM read cache of non-emulated memory drivers
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_RCACHE_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_RCACHE_H
+#define __NVM_RCACHE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Read function used to fill cache block
+ */
+typedef nvm_status_t (*pf_nvm_rcache_fill_t)(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_rcache_init       (void);
+nvm_status_t nvm_rcache_read       (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_nvm_rcache_fill_t pf_fill);
+void         nvm_rcache_update     (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+void         nvm_rcache_invalidate (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size);
+bool         nvm_rcache_is_en      (const nvm_mem_drv_name_t drv);
+void         nvm_rcache_get_stats  (const nvm_mem_drv_name_t drv, uint32_t * const p_hit, uint32_t * const p_miss);
+
+#endif // __NVM_RCACHE_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,599 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_stats.c
+*@brief     NVM performance counters
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_STATS
+* @{ <!-- BEGIN GROUP -->
+*
+*   Per region counters of operations, low level memory driver calls,
+*   erased pages, latency and NVM mutex wait.
+*
+*   Time is taken from nvm_if_get_timestamp() and differences are
+*   calculated unsigned, so free running counter may wrap around.
+*
+*   Memory driver call is accounted to region attached to its memory
+*   driver. Region is attached by nvm.c for duration of operation on it,
+*   while holding lock of its memory driver, therefore counters of region
+*   are guarded by the same lock as region data. Lock-free (seqlock) reads
+*   hold no lock and are counted by separate atomic counters, merged into
+*   region read counters when they are taken.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nvm_stats.h"
+
+// Interface
+#include "../../nvm_if.h"
+
+#if (( 1 == NVM_CFG_STATS_EN ) && ( 1 == NVM_CFG_EE_SEQLOCK_EN ))
+    #include <stdatomic.h>
+#endif
+
+#if ( 1 == NVM_CFG_STATS_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  No region attached to memory driver
+ */
+#define NVM_STATS_REGION_NONE       ((nvm_region_name_t) eNVM_REGION_NUM_OF )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Pointer to NVM configuration tables
+ */
+static const nvm_region_t *     gp_nvm_regions = NULL;
+static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
+
+/**
+ *  Region counters
+ */
+static nvm_stats_t g_stats[eNVM_REGION_NUM_OF] = { 0 };
+
+/**
+ *  Region attached to each memory driver
+ */
+static nvm_region_name_t g_stats_region[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+#if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+
+    /**
+     *  Number of lock-free reads and their bytes per region
+     */
+    static atomic_uint g_stats_lf_num[eNVM_REGION_NUM_OF];
+    static atomic_uint g_stats_lf_bytes[eNVM_REGION_NUM_OF];
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static nvm_stats_t *    nvm_stats_get_drv_region    (const nvm_mem_driver_t * const p_drv);
+static void             nvm_stats_add_call          (const nvm_mem_driver_t * const p_drv, const uint32_t ts);
+static void             nvm_stats_add_erase         (const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get counters of region attached to memory driver
+*
+* @param[in]	p_drv	- Memory driver
+* @return 		p_stats	- Region counters or NULL if no region is attached
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_stats_t * nvm_stats_get_drv_region(const nvm_mem_driver_t * const p_drv)
+{
+    const nvm_region_name_t region = g_stats_region[ p_drv - gp_nvm_drivers ];
+
+    return (( NVM_STATS_REGION_NONE != region ) ? &g_stats[region] : NULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account completed memory driver call
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	ts	    - Timestamp at start of call
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_stats_add_call(const nvm_mem_driver_t * const p_drv, const uint32_t ts)
+{
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+
+    if ( NULL != p_stats )
+    {
+        p_stats->drv_calls++;
+        p_stats->drv_time_sum += ( nvm_if_get_timestamp() - ts );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account erased pages
+*
+* @note     Pages are counted relative to page of region start address.
+*           Driver without "page_size" counts erase calls only.
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_stats_add_erase(const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size)
+{
+    nvm_stats_t * const p_stats     = nvm_stats_get_drv_region( p_drv );
+    const uint32_t      page_size   = p_drv->page_size;
+
+    if ( NULL != p_stats )
+    {
+        if  (   ( 0U != page_size )
+            &&  ( size > 0U ))
+        {
+            const uint32_t first = ( gp_nvm_regions[ g_stats_region[ p_drv - gp_nvm_drivers ]].start_addr / page_size );
+
+            for ( uint32_t page = ( addr / page_size ); page <= (( addr + size - 1U ) / page_size ); page++ )
+            {
+                p_stats->drv_erase_num++;
+
+                if  (   ( page >= first )
+                    &&  (( page - first ) < NVM_CFG_STATS_PAGE_NUM ))
+                {
+                    p_stats->page_erase[ page - first ]++;
+                }
+            }
+        }
+        else
+        {
+            p_stats->drv_erase_num++;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_STATS_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM performance counters API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize performance counters
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_init(void)
+{
+    gp_nvm_regions = nvm_cfg_get_regions();
+    gp_nvm_drivers = nvm_cfg_get_drivers();
+
+    NVM_ASSERT( NULL != gp_nvm_regions );
+    NVM_ASSERT( NULL != gp_nvm_drivers );
+
+    memset( &g_stats, 0, sizeof( g_stats ));
+
+    for ( uint32_t drv = 0U; drv < eNVM_MEM_DRV_NUM_OF; drv++ )
+    {
+        g_stats_region[drv] = NVM_STATS_REGION_NONE;
+    }
+
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        for ( uint32_t region = 0U; region < eNVM_REGION_NUM_OF; region++ )
+        {
+            atomic_store_explicit( &g_stats_lf_num[region], 0U, memory_order_relaxed );
+            atomic_store_explicit( &g_stats_lf_bytes[region], 0U, memory_order_relaxed );
+        }
+    #endif
+
+    return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Enter operation on region
+*
+* @note     Called once lock of region is taken. Time since start of
+*           operation is accounted as mutex wait.
+*
+* @param[in]	region	- NVM region
+* @param[in]	ts	    - Timestamp at start of operation
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_enter(const nvm_region_name_t region, const uint32_t ts)
+{
+    const uint32_t wait = ( nvm_if_get_timestamp() - ts );
+
+    g_stats[region].lock_wait_sum += wait;
+
+    if ( wait > g_stats[region].lock_wait_max )
+    {
+        g_stats[region].lock_wait_max = wait;
+    }
+
+    nvm_stats_attach( region );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Exit operation on region
+*
+* @note     Called before lock of region is released.
+*
+* @param[in]	region	- NVM region
+* @param[in]	op	    - Operation
+* @param[in]	size	- Number of bytes requested by operation
+* @param[in]	ts	    - Timestamp at start of operation
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_exit(const nvm_region_name_t region, const nvm_stats_op_t op, const uint32_t size, const uint32_t ts)
+{
+    nvm_stats_add_op( region, op, size, ts );
+    nvm_stats_detach( region );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account following memory driver calls to region
+*
+* @param[in]	region	- NVM region
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_attach(const nvm_region_name_t region)
+{
+    g_stats_region[ gp_nvm_regions[region].p_driver - gp_nvm_drivers ] = region;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop accounting memory driver calls to region
+*
+* @param[in]	region	- NVM region
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_detach(const nvm_region_name_t region)
+{
+    g_stats_region[ gp_nvm_regions[region].p_driver - gp_nvm_drivers ] = NVM_STATS_REGION_NONE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account completed operation
+*
+* @param[in]	region	- NVM region
+* @param[in]	op	    - Operation
+* @param[in]	size	- Number of bytes requested by operation
+* @param[in]	ts	    - Timestamp at start of operation
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_add_op(const nvm_region_name_t region, const nvm_stats_op_t op, const uint32_t size, const uint32_t ts)
+{
+    nvm_op_stats_t * const  p_op    = &g_stats[region].op[op];
+    const uint32_t          time    = ( nvm_if_get_timestamp() - ts );
+
+    p_op->num++;
+    p_op->bytes     += size;
+    p_op->time_sum  += time;
+
+    if ( time > p_op->time_max )
+    {
+        p_op->time_max = time;
+    }
+}
+
+#if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Account completed lock-free read
+    *
+    * @note     Called without holding any lock. Only number of reads and
+    *           their bytes are counted, time of RAM copy is not measured.
+    *
+    * @param[in]	region	- NVM region
+    * @param[in]	size	- Number of bytes requested by read
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_stats_add_read_lockfree(const nvm_region_name_t region, const uint32_t size)
+    {
+        atomic_fetch_add_explicit( &g_stats_lf_num[region], 1U, memory_order_relaxed );
+        atomic_fetch_add_explicit( &g_stats_lf_bytes[region], size, memory_order_relaxed );
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get region counters
+*
+* @param[in]	region	- NVM region
+* @param[out]	p_stats	- Region counters
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_get(const nvm_region_name_t region, nvm_stats_t * const p_stats)
+{
+    memcpy( p_stats, &g_stats[region], sizeof( nvm_stats_t ));
+
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        p_stats->op[eNVM_STATS_OP_READ].num     += atomic_load_explicit( &g_stats_lf_num[region], memory_order_relaxed );
+        p_stats->op[eNVM_STATS_OP_READ].bytes   += atomic_load_explicit( &g_stats_lf_bytes[region], memory_order_relaxed );
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset region counters
+*
+* @param[in]	region	- NVM region
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_stats_reset(const nvm_region_name_t region)
+{
+    memset( &g_stats[region], 0, sizeof( nvm_stats_t ));
+
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        atomic_store_explicit( &g_stats_lf_num[region], 0U, memory_order_relaxed );
+        atomic_store_explicit( &g_stats_lf_bytes[region], 0U, memory_order_relaxed );
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted memory driver write
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Data to write
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_write(const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+    const nvm_status_t  status  = p_drv->pf_nvm_write( addr, size, p_data );
+
+    if ( NULL != p_stats )
+    {
+        p_stats->drv_write_bytes += size;
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted memory driver read
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_read(const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+    const nvm_status_t  status  = p_drv->pf_nvm_read( addr, size, p_data );
+
+    if ( NULL != p_stats )
+    {
+        p_stats->drv_read_bytes += size;
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted memory driver erase
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_erase(const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    const nvm_status_t  status  = p_drv->pf_nvm_erase( addr, size );
+
+    nvm_stats_add_erase( p_drv, addr, size );
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted vectored memory driver write
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	p_vec	- Ranges
+* @param[in]	num	    - Number of ranges
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_write_v(const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+    const nvm_status_t  status  = p_drv->pf_nvm_write_v( p_vec, num );
+
+    for ( uint32_t i = 0U; ( i < num ) && ( NULL != p_stats ); i++ )
+    {
+        p_stats->drv_write_bytes += p_vec[i].size;
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted vectored memory driver read
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	p_vec	- Ranges
+* @param[in]	num	    - Number of ranges
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_read_v(const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+    const nvm_status_t  status  = p_drv->pf_nvm_read_v( p_vec, num );
+
+    for ( uint32_t i = 0U; ( i < num ) && ( NULL != p_stats ); i++ )
+    {
+        p_stats->drv_read_bytes += p_vec[i].size;
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted vectored memory driver erase
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	p_vec	- Ranges
+* @param[in]	num	    - Number of ranges
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_erase_v(const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    const nvm_status_t  status  = p_drv->pf_nvm_erase_v( p_vec, num );
+
+    for ( uint32_t i = 0U; i < num; i++ )
+    {
+        nvm_stats_add_erase( p_drv, p_vec[i].addr, p_vec[i].size );
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted start of asynchronous memory driver write
+*
+* @note     Only start of transfer is timed.
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Data to write
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_write_async(const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+    const nvm_status_t  status  = p_drv->pf_nvm_write_async( addr, size, p_data );
+
+    if ( NULL != p_stats )
+    {
+        p_stats->drv_write_bytes += size;
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counted start of asynchronous memory driver read
+*
+* @note     Only start of transfer is timed.
+*
+* @param[in]	p_drv	- Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @return 		status	- Status of driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_stats_dev_read_async(const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    const uint32_t      ts      = nvm_if_get_timestamp();
+    nvm_stats_t * const p_stats = nvm_stats_get_drv_region( p_drv );
+    const nvm_status_t  status  = p_drv->pf_nvm_read_async( addr, size, p_data );
+
+    if ( NULL != p_stats )
+    {
+        p_stats->drv_read_bytes += size;
+    }
+
+    nvm_stats_add_call( p_drv, ts );
+
+    return status;
+}
+
+#endif // ( 1 == NVM_CFG_STATS_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
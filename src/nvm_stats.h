@@ -0,0 +1,95 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_stats.h
+*@brief     NVM performance counters
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_STATS_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_STATS_H
+#define __NVM_STATS_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Low level memory driver calls
+ *
+ * 	@note	With NVM_CFG_STATS_EN calls are counted and timed, otherwise
+ * 			driver function is called directly.
+ */
+#if ( 1 == NVM_CFG_STATS_EN )
+    #define NVM_DEV_WRITE( p_drv, addr, size, p_data )          nvm_stats_dev_write(( p_drv ), ( addr ), ( size ), ( p_data ))
+    #define NVM_DEV_READ( p_drv, addr, size, p_data )           nvm_stats_dev_read(( p_drv ), ( addr ), ( size ), ( p_data ))
+    #define NVM_DEV_ERASE( p_drv, addr, size )                  nvm_stats_dev_erase(( p_drv ), ( addr ), ( size ))
+    #define NVM_DEV_WRITE_V( p_drv, p_vec, num )                nvm_stats_dev_write_v(( p_drv ), ( p_vec ), ( num ))
+    #define NVM_DEV_READ_V( p_drv, p_vec, num )                 nvm_stats_dev_read_v(( p_drv ), ( p_vec ), ( num ))
+    #define NVM_DEV_ERASE_V( p_drv, p_vec, num )                nvm_stats_dev_erase_v(( p_drv ), ( p_vec ), ( num ))
+    #define NVM_DEV_WRITE_ASYNC( p_drv, addr, size, p_data )    nvm_stats_dev_write_async(( p_drv ), ( addr ), ( size ), ( p_data ))
+    #define NVM_DEV_READ_ASYNC( p_drv, addr, size, p_data )     nvm_stats_dev_read_async(( p_drv ), ( addr ), ( size ), ( p_data ))
+#else
+    #define NVM_DEV_WRITE( p_drv, addr, size, p_data )          (( p_drv )->pf_nvm_write(( addr ), ( size ), ( p_data )))
+    #define NVM_DEV_READ( p_drv, addr, size, p_data )           (( p_drv )->pf_nvm_read(( addr ), ( size ), ( p_data )))
+    #define NVM_DEV_ERASE( p_drv, addr, size )                  (( p_drv )->pf_nvm_erase(( addr ), ( size )))
+    #define NVM_DEV_WRITE_V( p_drv, p_vec, num )                (( p_drv )->pf_nvm_write_v(( p_vec ), ( num )))
+    #define NVM_DEV_READ_V( p_drv, p_vec, num )                 (( p_drv )->pf_nvm_read_v(( p_vec ), ( num )))
+    #define NVM_DEV_ERASE_V( p_drv, p_vec, num )                (( p_drv )->pf_nvm_erase_v(( p_vec ), ( num )))
+    #define NVM_DEV_WRITE_ASYNC( p_drv, addr, size, p_data )    (( p_drv )->pf_nvm_write_async(( addr ), ( size ), ( p_data )))
+    #define NVM_DEV_READ_ASYNC( p_drv, addr, size, p_data )     (( p_drv )->pf_nvm_read_async(( addr ), ( size ), ( p_data )))
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == NVM_CFG_STATS_EN )
+    nvm_status_t    nvm_stats_init      (void);
+    void            nvm_stats_enter     (const nvm_region_name_t region, const uint32_t ts);
+    void            nvm_stats_exit      (const nvm_region_name_t region, const nvm_stats_op_t op, const uint32_t size, const uint32_t ts);
+    void            nvm_stats_attach    (const nvm_region_name_t region);
+    void            nvm_stats_detach    (const nvm_region_name_t region);
+    void            nvm_stats_add_op    (const nvm_region_name_t region, const nvm_stats_op_t op, const uint32_t size, const uint32_t ts);
+    void            nvm_stats_get       (const nvm_region_name_t region, nvm_stats_t * const p_stats);
+    void            nvm_stats_reset     (const nvm_region_name_t region);
+
+    #if ( 1 == NVM_CFG_EE_SEQLOCK_EN )
+        void        nvm_stats_add_read_lockfree (const nvm_region_name_t region, const uint32_t size);
+    #endif
+
+    nvm_status_t    nvm_stats_dev_write         (const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+    nvm_status_t    nvm_stats_dev_read          (const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+    nvm_status_t    nvm_stats_dev_erase         (const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size);
+    nvm_status_t    nvm_stats_dev_write_v       (const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num);
+    nvm_status_t    nvm_stats_dev_read_v        (const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num);
+    nvm_status_t    nvm_stats_dev_erase_v       (const nvm_mem_driver_t * const p_drv, const nvm_vec_t * const p_vec, const uint32_t num);
+    nvm_status_t    nvm_stats_dev_write_async   (const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+    nvm_status_t    nvm_stats_dev_read_async    (const nvm_mem_driver_t * const p_drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+#endif
+
+#endif // __NVM_STATS_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,294 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_trace.c
+*@brief     NVM operation trace
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_TRACE
+* @{ <!-- BEGIN GROUP -->
+*
+*   Fixed size binary events of NVM operations are stored to static ring
+*   buffer, oldest events are overwritten. Recording costs one timestamp
+*   and 16 byte copy, so operations can stay traced in release build.
+*   Events are decoded to text only when trace is read out.
+*
+*   Slot of event is reserved with atomic increment, therefore events can
+*   be recorded concurrently from regions of different memory drivers.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "nvm_trace.h"
+
+// Interface
+#include "../../nvm_if.h"
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+    #include <stdatomic.h>
+#endif
+
+#if (( 1 == NVM_CFG_TRACE_EN ) || ( 1 == NVM_CFG_DEBUG_EN ))
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Text format of event
+ */
+#define NVM_TRACE_FMT           "NVM: %s region <%d> addr: 0x%04X size: %d. Status: %s"
+
+/**
+ *  Size of decoded event text
+ */
+#define NVM_TRACE_STR_SIZE      ( 96U )
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+
+    /**
+     *  Index of event slot must follow wrap of event counter
+     */
+    NVM_STATIC_ASSERT(( NVM_CFG_TRACE_SIZE > 0U ) && ( 0U == ( NVM_CFG_TRACE_SIZE & ( NVM_CFG_TRACE_SIZE - 1U ))), "NVM_CFG_TRACE_SIZE must be power of two!" );
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Operation names
+ */
+static const char * gs_trace_op[eNVM_TRACE_NUM_OF] =
+{
+    [eNVM_TRACE_WRITE]          = "WRITE",
+    [eNVM_TRACE_READ]           = "READ",
+    [eNVM_TRACE_ERASE]          = "ERASE",
+    [eNVM_TRACE_SYNC]           = "SYNC",
+    [eNVM_TRACE_PREFETCH]       = "PREFETCH",
+    [eNVM_TRACE_FLUSH]          = "FLUSH",
+    [eNVM_TRACE_AB_ERASE]       = "AB_ERASE",
+    [eNVM_TRACE_WRITE_BATCH]    = "WRITE_BATCH",
+    [eNVM_TRACE_READ_BATCH]     = "READ_BATCH",
+    [eNVM_TRACE_ERASE_BATCH]    = "ERASE_BATCH",
+    [eNVM_TRACE_SYNC_REQ]       = "SYNC_REQ",
+    [eNVM_TRACE_SYNC_DONE]      = "SYNC_DONE",
+    [eNVM_TRACE_WRITE_ASYNC]    = "WRITE_ASYNC",
+    [eNVM_TRACE_READ_ASYNC]     = "READ_ASYNC",
+    [eNVM_TRACE_ASYNC_DONE]     = "ASYNC_DONE",
+    [eNVM_TRACE_LOG_LOAD]       = "LOG_LOAD",
+    [eNVM_TRACE_LOG_COMPACT]    = "LOG_COMPACT",
+};
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+
+    /**
+     *  Trace buffer
+     */
+    static nvm_trace_evt_t g_trace[NVM_CFG_TRACE_SIZE] = { 0 };
+
+    /**
+     *  Number of recorded events. Slot of next event is counter modulo
+     *  buffer size.
+     */
+    static atomic_uint g_trace_cnt = 0U;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static const char * nvm_trace_get_op_str(const uint32_t op);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get operation name
+*
+* @param[in]	op	- Traced operation
+* @return 		str	- Operation name
+*/
+////////////////////////////////////////////////////////////////////////////////
+static const char * nvm_trace_get_op_str(const uint32_t op)
+{
+    return (( op < eNVM_TRACE_NUM_OF ) ? gs_trace_op[op] : "N/A" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_TRACE_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM operation trace API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == NVM_CFG_TRACE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Record event
+    *
+    * @note     Region field holds memory driver for EEPROM log events.
+    *
+    * @param[in]	op	    - Traced operation
+    * @param[in]	region	- NVM region, memory driver or NVM_TRACE_NO_REGION
+    * @param[in]	addr	- Address or operation specific value
+    * @param[in]	size	- Size or operation specific value
+    * @param[in]	status	- Status of operation
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_trace_add(const nvm_trace_op_t op, const uint32_t region, const uint32_t addr, const uint32_t size, const nvm_status_t status)
+    {
+        const uint32_t          cnt     = atomic_fetch_add_explicit( &g_trace_cnt, 1U, memory_order_relaxed );
+        nvm_trace_evt_t * const p_evt   = &g_trace[ cnt % NVM_CFG_TRACE_SIZE ];
+
+        p_evt->timestamp    = nvm_if_get_timestamp();
+        p_evt->addr         = addr;
+        p_evt->size         = size;
+        p_evt->op           = (uint8_t) op;
+        p_evt->region       = (uint8_t) region;
+        p_evt->status       = (uint8_t) status;
+        p_evt->reserved     = 0U;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Copy recorded events
+    *
+    * @note     Newest events are copied, oldest first. Event being recorded
+    *           while copied might be incomplete.
+    *
+    * @param[out]	p_evt	- Events
+    * @param[in]	max	    - Maximum number of events to copy
+    * @return 		num     - Number of copied events
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint32_t nvm_trace_get(nvm_trace_evt_t * const p_evt, const uint32_t max)
+    {
+        const uint32_t  cnt = atomic_load_explicit( &g_trace_cnt, memory_order_acquire );
+        uint32_t        num = (( cnt < NVM_CFG_TRACE_SIZE ) ? cnt : NVM_CFG_TRACE_SIZE );
+
+        if ( num > max )
+        {
+            num = max;
+        }
+
+        for ( uint32_t i = 0U; i < num; i++ )
+        {
+            p_evt[i] = g_trace[ ( cnt - num + i ) % NVM_CFG_TRACE_SIZE ];
+        }
+
+        return num;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Drop recorded events
+    *
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_trace_clear(void)
+    {
+        atomic_store_explicit( &g_trace_cnt, 0U, memory_order_release );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Decode event to text
+    *
+    * @param[in]	p_evt	- Event
+    * @param[out]	p_str	- Text, always null terminated
+    * @param[in]	size	- Size of text buffer
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_trace_decode(const nvm_trace_evt_t * const p_evt, char * const p_str, const uint32_t size)
+    {
+        const int len = snprintf( p_str, size, "%10u ", (unsigned int) p_evt->timestamp );
+
+        if  (   ( len > 0 )
+            &&  ((uint32_t) len < size ))
+        {
+            (void) snprintf( &p_str[len], ( size - (uint32_t) len ), NVM_TRACE_FMT,
+                             nvm_trace_get_op_str( p_evt->op ), (int) p_evt->region, (unsigned int) p_evt->addr,
+                             (int) p_evt->size, nvm_get_status_str((nvm_status_t) p_evt->status ));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Print recorded events, oldest first
+    *
+    * @param[in]	pf_print	- Print function
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_trace_dump(pf_nvm_trace_print_t pf_print)
+    {
+        const uint32_t  cnt = atomic_load_explicit( &g_trace_cnt, memory_order_acquire );
+        const uint32_t  num = (( cnt < NVM_CFG_TRACE_SIZE ) ? cnt : NVM_CFG_TRACE_SIZE );
+        char            str[NVM_TRACE_STR_SIZE];
+
+        for ( uint32_t i = 0U; i < num; i++ )
+        {
+            nvm_trace_decode( &g_trace[ ( cnt - num + i ) % NVM_CFG_TRACE_SIZE ], str, sizeof( str ));
+            pf_print( str );
+        }
+    }
+
+#else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Print event at once
+    *
+    * @note     Used in debug mode when trace buffer is disabled.
+    *
+    * @param[in]	op	    - Traced operation
+    * @param[in]	region	- NVM region, memory driver or NVM_TRACE_NO_REGION
+    * @param[in]	addr	- Address or operation specific value
+    * @param[in]	size	- Size or operation specific value
+    * @param[in]	status	- Status of operation
+    * @return 		void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void nvm_trace_print(const nvm_trace_op_t op, const uint32_t region, const uint32_t addr, const uint32_t size, const nvm_status_t status)
+    {
+        NVM_DBG_PRINT( NVM_TRACE_FMT, nvm_trace_get_op_str( op ), (int) region, (unsigned int) addr, (int) size, nvm_get_status_str( status ));
+    }
+
+#endif
+
+#endif // (( 1 == NVM_CFG_TRACE_EN ) || ( 1 == NVM_CFG_DEBUG_EN ))
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
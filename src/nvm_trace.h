@@ -0,0 +1,74 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_trace.h
+*@brief     NVM operation trace
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_TRACE_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_TRACE_H
+#define __NVM_TRACE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Region field of event not related to single region
+ */
+#define NVM_TRACE_NO_REGION         ( 0xFFU )
+
+/**
+ * 	Record NVM operation
+ *
+ * 	@note	With NVM_CFG_TRACE_EN event is stored to trace buffer. Otherwise
+ * 			in debug mode event is printed at once.
+ */
+#if ( 1 == NVM_CFG_TRACE_EN )
+    #define NVM_TRACE( op, region, addr, size, status )     nvm_trace_add(( op ), ( region ), ( addr ), ( size ), ( status ))
+#elif ( 1 == NVM_CFG_DEBUG_EN )
+    #define NVM_TRACE( op, region, addr, size, status )     nvm_trace_print(( op ), ( region ), ( addr ), ( size ), ( status ))
+#else
+    #define NVM_TRACE( op, region, addr, size, status )     { ; }
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == NVM_CFG_TRACE_EN )
+    void        nvm_trace_add       (const nvm_trace_op_t op, const uint32_t region, const uint32_t addr, const uint32_t size, const nvm_status_t status);
+    uint32_t    nvm_trace_get       (nvm_trace_evt_t * const p_evt, const uint32_t max);
+    void        nvm_trace_clear     (void);
+    void        nvm_trace_decode    (const nvm_trace_evt_t * const p_evt, char * const p_str, const uint32_t size);
+    void        nvm_trace_dump      (pf_nvm_trace_print_t pf_print);
+#elif ( 1 == NVM_CFG_DEBUG_EN )
+    void        nvm_trace_print     (const nvm_trace_op_t op, const uint32_t region, const uint32_t addr, const uint32_t size, const nvm_status_t status);
+#endif
+
+#endif // __NVM_TRACE_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
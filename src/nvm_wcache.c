@@ -0,0 +1,395 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_wcache.c
+*@brief     NVM write coalescing cache of non-emulated memory drivers
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_WCACHE
+* @{ <!-- BEGIN GROUP -->
+*
+*   Write-back cache of single device page per memory driver.
+*
+*   Consecutive small writes into the same device page are merged in RAM
+*   and programmed with single driver write. Cached page is flushed when
+*   write moves to another page, on sync and on explicit flush. Gaps
+*   between merged writes and programming unit padding are filled with
+*   current device content, so programmed range is always contiguous.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nvm_wcache.h"
+#include "nvm_stats.h"
+
+#if ( 1 == NVM_CFG_WCACHE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Cached device page
+ */
+typedef struct
+{
+    uint8_t     buf[NVM_CFG_WCACHE_SIZE];   /**<Page data */
+    uint32_t    page_addr;                  /**<Device address of cached page */
+    uint32_t    start;                      /**<Start of dirty range inside page */
+    uint32_t    end;                        /**<End (exclusive) of dirty range inside page. Equal to start if clean. */
+} nvm_wcache_line_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ *  Pointer to memory drivers configuration table
+ */
+static const nvm_mem_driver_t * gp_nvm_drivers = NULL;
+
+/**
+ *  Cache line per memory driver
+ */
+static nvm_wcache_line_t g_wcache[eNVM_MEM_DRV_NUM_OF] = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_wcache_fill     (const nvm_mem_drv_name_t drv, const uint32_t from, const uint32_t to);
+static nvm_status_t nvm_wcache_extend   (const nvm_mem_drv_name_t drv, const uint32_t off, const uint32_t len);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fill part of cached page with device content
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	from	- Start offset inside page
+* @param[in]	to	    - End offset (exclusive) inside page
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_wcache_fill(const nvm_mem_drv_name_t drv, const uint32_t from, const uint32_t to)
+{
+    nvm_status_t                status  = eNVM_OK;
+    nvm_wcache_line_t * const   p_line  = &g_wcache[drv];
+
+    if ( from < to )
+    {
+        if ( eNVM_OK != NVM_DEV_READ( &gp_nvm_drivers[drv], p_line->page_addr + from, ( to - from ), &p_line->buf[from] ))
+        {
+            status = eNVM_ERROR;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Extend dirty range of cached page by write
+*
+* @brief    Dirty range is aligned to programming unit. Bytes that become
+*           part of dirty range, but are not written, are filled with
+*           device content.
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	off	    - Offset of write inside page
+* @param[in]	len	    - Size of write
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_wcache_extend(const nvm_mem_drv_name_t drv, const uint32_t off, const uint32_t len)
+{
+    nvm_status_t                status      = eNVM_OK;
+    nvm_wcache_line_t * const   p_line      = &g_wcache[drv];
+    const uint32_t              page_size   = gp_nvm_drivers[drv].page_size;
+    const uint32_t              prog_size   = (( 0U == gp_nvm_drivers[drv].prog_size ) ? 1U : gp_nvm_drivers[drv].prog_size );
+    uint32_t                    start       = ( off - ( off % prog_size ));
+    uint32_t                    end         = ((( off + len + prog_size - 1U ) / prog_size ) * prog_size );
+
+    if ( end > page_size )
+    {
+        end = page_size;
+    }
+
+    // Clean page: dirty range is empty
+    if ( p_line->start == p_line->end )
+    {
+        p_line->start   = start;
+        p_line->end     = start;
+    }
+
+    if ( start > p_line->start )
+    {
+        start = p_line->start;
+    }
+
+    if ( end < p_line->end )
+    {
+        end = p_line->end;
+    }
+
+    // Fill new bytes in front of and behind current dirty range, except written ones
+    if ( start < p_line->start )
+    {
+        status |= nvm_wcache_fill( drv, start, (( p_line->start < off ) ? p_line->start : off ));
+        status |= nvm_wcache_fill( drv, ( off + len ), p_line->start );
+    }
+
+    if ( end > p_line->end )
+    {
+        status |= nvm_wcache_fill( drv, (( p_line->end > ( off + len )) ? p_line->end : ( off + len )), end );
+        status |= nvm_wcache_fill( drv, p_line->end, off );
+    }
+
+    if ( eNVM_OK == status )
+    {
+        p_line->start   = start;
+        p_line->end     = end;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_WCACHE_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM write cache API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize write cache
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_wcache_init(void)
+{
+    gp_nvm_drivers = nvm_cfg_get_drivers();
+    NVM_ASSERT( NULL != gp_nvm_drivers );
+
+    memset( &g_wcache, 0, sizeof( g_wcache ));
+    gb_is_init = true;
+
+    return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if memory driver writes through cache
+*
+* @param[in]	drv	    - Memory driver
+* @return 		en	    - Write cache enabled
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nvm_wcache_is_en(const nvm_mem_drv_name_t drv)
+{
+    return (( true == gb_is_init ) && ( true == gp_nvm_drivers[drv].wcache_en ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write through cache
+*
+* @note     Write to other page than cached one flushes cached page first.
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[in]	p_data	- Data to write
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_wcache_write(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    nvm_status_t                status      = eNVM_OK;
+    nvm_wcache_line_t * const   p_line      = &g_wcache[drv];
+    const uint32_t              page_size   = gp_nvm_drivers[drv].page_size;
+    uint32_t                    done        = 0U;
+
+    while (( done < size ) && ( eNVM_OK == status ))
+    {
+        const uint32_t  cur_addr    = ( addr + done );
+        const uint32_t  page_addr   = ( cur_addr - ( cur_addr % page_size ));
+        const uint32_t  off         = ( cur_addr - page_addr );
+        uint32_t        len         = ( page_size - off );
+
+        if ( len > ( size - done ))
+        {
+            len = ( size - done );
+        }
+
+        // Page boundary crossed
+        if  (   ( p_line->start != p_line->end )
+            &&  ( page_addr != p_line->page_addr ))
+        {
+            status = nvm_wcache_flush( drv );
+        }
+
+        if ( eNVM_OK == status )
+        {
+            p_line->page_addr = page_addr;
+
+            status = nvm_wcache_extend( drv, off, len );
+        }
+
+        if ( eNVM_OK == status )
+        {
+            memcpy( &p_line->buf[off], &p_data[done], len );
+            done += len;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read through cache
+*
+* @brief    Data are read from device and overlaid by cached data that are
+*           not yet programmed.
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @param[out]	p_data	- Read data
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_wcache_read(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    nvm_status_t                        status  = eNVM_OK;
+    const nvm_wcache_line_t * const     p_line  = &g_wcache[drv];
+
+    if ( eNVM_OK != NVM_DEV_READ( &gp_nvm_drivers[drv], addr, size, p_data ))
+    {
+        status = eNVM_ERROR;
+    }
+    else if ( p_line->start != p_line->end )
+    {
+        const uint32_t dirty_start  = ( p_line->page_addr + p_line->start );
+        const uint32_t dirty_end    = ( p_line->page_addr + p_line->end );
+        const uint32_t start        = (( addr > dirty_start ) ? addr : dirty_start );
+        const uint32_t end          = ((( addr + size ) < dirty_end ) ? ( addr + size ) : dirty_end );
+
+        if ( start < end )
+        {
+            memcpy( &p_data[ start - addr ], &p_line->buf[ start - p_line->page_addr ], ( end - start ));
+        }
+    }
+    else
+    {
+        // Nothing cached
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase through cache
+*
+* @note     Cached page overlapping erased range is flushed first, so
+*           erase is not undone by later flush.
+*
+* @param[in]	drv	    - Memory driver
+* @param[in]	addr	- Device address
+* @param[in]	size	- Size in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_wcache_erase(const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size)
+{
+    nvm_status_t                        status  = eNVM_OK;
+    const nvm_wcache_line_t * const     p_line  = &g_wcache[drv];
+
+    if  (   ( p_line->start != p_line->end )
+        &&  ( addr < ( p_line->page_addr + p_line->end ))
+        &&  (( p_line->page_addr + p_line->start ) < ( addr + size )))
+    {
+        status = nvm_wcache_flush( drv );
+    }
+
+    if ( eNVM_OK == status )
+    {
+        if ( eNVM_OK != NVM_DEV_ERASE( &gp_nvm_drivers[drv], addr, size ))
+        {
+            status = eNVM_ERROR;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Flush cached page to device
+*
+* @note     On failure page stays cached, so flush can be retried.
+*
+* @param[in]	drv	    - Memory driver
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_wcache_flush(const nvm_mem_drv_name_t drv)
+{
+    nvm_status_t                status  = eNVM_OK;
+    nvm_wcache_line_t * const   p_line  = &g_wcache[drv];
+
+    if  (   ( true == gb_is_init )
+        &&  ( p_line->start != p_line->end ))
+    {
+        if ( eNVM_OK == NVM_DEV_WRITE( &gp_nvm_drivers[drv], p_line->page_addr + p_line->start, ( p_line->end - p_line->start ), &p_line->buf[p_line->start] ))
+        {
+            p_line->end = p_line->start;
+        }
+        else
+        {
+            status = eNVM_ERROR;
+        }
+    }
+
+    return status;
+}
+
+#endif // ( 1 == NVM_CFG_WCACHE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
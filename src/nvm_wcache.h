@@ -0,0 +1,48 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_wcache.h
+*@brief     NVM write coalescing cache of non-emulated memory drivers
+*@author    Ziga Miklosic
+*@email		ziga.miklosic@gmail.com
+*@date      15.02.2023
+*@version	V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_WCACHE_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_WCACHE_H
+#define __NVM_WCACHE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_wcache_init   (void);
+nvm_status_t nvm_wcache_write  (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t nvm_wcache_read   (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+nvm_status_t nvm_wcache_erase  (const nvm_mem_drv_name_t drv, const uint32_t addr, const uint32_t size);
+nvm_status_t nvm_wcache_flush  (const nvm_mem_drv_name_t drv);
+bool         nvm_wcache_is_en  (const nvm_mem_drv_name_t drv);
+
+#endif // __NVM_WCACHE_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////